@@ -0,0 +1,27 @@
+using UnrealBuildTool;
+
+public class PR_Foley : ModuleRules
+{
+	public PR_Foley(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"DeveloperSettings", // UPRFoleySettings
+			"PhysicsCore", // EPhysicalSurface, UPhysicalMaterial
+			"NetCore", // FPRFoleyNetEvent::NetSerialize
+			"Niagara",
+			"AudioExtensions" // FAudioParameter (MetaSound inputs)
+		});
+
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"Landscape", // Weightmap sampling, surface grid bake
+			"AssetRegistry"
+		});
+	}
+}
@@ -0,0 +1,343 @@
+#include "Commandlets/PRFoleyBakeSurfaceGridCommandlet.h"
+#include "Components/PrimitiveComponent.h"
+#include "Data/PRFoleySurfaceGrid.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "LandscapeProxy.h"
+#include "PRAudioLog.h"
+#include "PRFoleySettings.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Subsystems/PRFoleyLandscapeSubsystem.h"
+#include "UObject/Package.h"
+
+namespace {
+
+struct FBakeOptions {
+  float CellSize = 50.0f;
+  ECollisionChannel Channel = ECC_Visibility;
+  float WalkableZ = 0.7f;
+  float Headroom = 150.0f;
+  float StepHeight = 30.0f;
+  int64 MaxCells = 100 * 1000 * 1000;
+};
+
+#if WITH_EDITOR
+
+UWorld *LoadWorld(const FString &MapName) {
+  UPackage *Package = LoadPackage(nullptr, *MapName, LOAD_None);
+  UWorld *World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+  if (!World) {
+    return nullptr;
+  }
+
+  World->AddToRoot();
+  World->WorldType = EWorldType::Editor;
+  if (!World->bIsWorldInitialized) {
+    World->InitWorld(UWorld::InitializationValues()
+                         .ShouldSimulatePhysics(false)
+                         .EnableTraceCollision(true)
+                         .CreatePhysicsScene(true)
+                         .CreateNavigation(false)
+                         .CreateAISystem(false)
+                         .AllowAudioPlayback(false));
+  }
+  World->UpdateWorldComponents(false, false);
+
+  for (ULevelStreaming *Streaming : World->GetStreamingLevels()) {
+    if (Streaming) {
+      Streaming->SetShouldBeLoaded(true);
+      Streaming->SetShouldBeVisible(true);
+    }
+  }
+  World->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+  return World;
+}
+
+void UnloadWorld(UWorld *World) {
+  World->DestroyWorld(false);
+  World->RemoveFromRoot();
+  CollectGarbage(RF_NoFlags);
+}
+
+/** Bounds of everything that blocks the channel, movable included. */
+FBox GetWalkableBounds(UWorld &World, ECollisionChannel Channel) {
+  FBox Bounds(ForceInit);
+  for (TActorIterator<AActor> It(&World); It; ++It) {
+    It->ForEachComponent<UPrimitiveComponent>(
+        false, [&Bounds, Channel](const UPrimitiveComponent *Component) {
+          if (Component->IsRegistered() &&
+              Component->IsQueryCollisionEnabled() &&
+              Component->GetCollisionResponseToChannel(Channel) ==
+                  ECR_Block) {
+            Bounds += Component->Bounds.GetBox();
+          }
+        });
+  }
+  return Bounds;
+}
+
+bool TraceGround(UWorld &World, const FVector2D &Point, float TopZ,
+                 float BottomZ, const FBakeOptions &Options,
+                 FHitResult &OutHit) {
+  FCollisionQueryParams Params(SCENE_QUERY_STAT(PRFoleyBakeSurfaceGrid),
+                               true);
+  Params.bReturnPhysicalMaterial = true;
+  return World.LineTraceSingleByChannel(OutHit, FVector(Point, TopZ),
+                                        FVector(Point, BottomZ),
+                                        Options.Channel, Params);
+}
+
+void AddSurfaceWeights(UPRFoleyLandscapeSubsystem *Landscapes,
+                       const FHitResult &Hit, float *Weights) {
+  FPRLandscapeSurfaceSample Sample;
+  if (Landscapes && Hit.GetActor() &&
+      Hit.GetActor()->IsA<ALandscapeProxy>() &&
+      Landscapes->SampleSurfaces(Hit, Sample)) {
+    Weights[Sample.PrimarySurface] += Sample.PrimaryWeight;
+    Weights[Sample.SecondarySurface] += Sample.SecondaryWeight;
+    return;
+  }
+  const EPhysicalSurface Surface =
+      Hit.PhysMaterial.IsValid() ? Hit.PhysMaterial->SurfaceType.GetValue()
+                                 : SurfaceType_Default;
+  Weights[Surface] += 1.0f;
+}
+
+FPRFoleySurfaceCell BakeCell(UWorld &World,
+                             UPRFoleyLandscapeSubsystem *Landscapes,
+                             const FVector2D &Center, float TopZ,
+                             float BottomZ, const FBakeOptions &Options) {
+  FPRFoleySurfaceCell Cell;
+
+  FHitResult Hit;
+  if (!TraceGround(World, Center, TopZ, BottomZ, Options, Hit) ||
+      Hit.ImpactNormal.Z < Options.WalkableZ) {
+    return Cell;
+  }
+
+  const FVector Normal = Hit.ImpactNormal;
+  Cell.Flags = EPRFoleySurfaceCellFlags::Walkable;
+  Cell.Height = Hit.ImpactPoint.Z;
+  Cell.NormalX = static_cast<int8>(FMath::RoundToInt(Normal.X * 127.0));
+  Cell.NormalY = static_cast<int8>(FMath::RoundToInt(Normal.Y * 127.0));
+
+  const UPrimitiveComponent *Component = Hit.GetComponent();
+  if (!Component || Component->Mobility != EComponentMobility::Static) {
+    Cell.Flags |= EPRFoleySurfaceCellFlags::Dynamic;
+  }
+
+  // Walkable ground under the first hit: bridges, upper floors, overhangs
+  FHitResult Below;
+  if (TraceGround(World, Center, Cell.Height - Options.Headroom, BottomZ,
+                  Options, Below) &&
+      !Below.bStartPenetrating && Below.ImpactNormal.Z >= Options.WalkableZ) {
+    Cell.Flags |= EPRFoleySurfaceCellFlags::MultiLevel;
+  }
+
+  float Weights[SurfaceType_Max] = {};
+  AddSurfaceWeights(Landscapes, Hit, Weights);
+
+  const float Offset = Options.CellSize * 0.25f;
+  const FVector2D SampleOffsets[4] = {{Offset, Offset},
+                                      {-Offset, Offset},
+                                      {Offset, -Offset},
+                                      {-Offset, -Offset}};
+  for (const FVector2D &SampleOffset : SampleOffsets) {
+    FHitResult SampleHit;
+    if (!TraceGround(World, Center + SampleOffset, TopZ, BottomZ, Options,
+                     SampleHit)) {
+      Cell.Flags |= EPRFoleySurfaceCellFlags::MultiLevel;
+      continue;
+    }
+    // A ledge or step inside the cell cannot be stored as one plane
+    const float PlaneZ = Cell.Height - (Normal.X * SampleOffset.X +
+                                        Normal.Y * SampleOffset.Y) /
+                                           Normal.Z;
+    if (FMath::Abs(SampleHit.ImpactPoint.Z - PlaneZ) > Options.StepHeight) {
+      Cell.Flags |= EPRFoleySurfaceCellFlags::MultiLevel;
+    }
+    AddSurfaceWeights(Landscapes, SampleHit, Weights);
+  }
+
+  int32 Primary = SurfaceType_Default;
+  int32 Secondary = INDEX_NONE;
+  float TotalWeight = 0.0f;
+  for (int32 Surface = 0; Surface < SurfaceType_Max; ++Surface) {
+    TotalWeight += Weights[Surface];
+    if (Weights[Surface] > Weights[Primary]) {
+      Secondary = Primary;
+      Primary = Surface;
+    } else if (Surface != Primary &&
+               (Secondary == INDEX_NONE ||
+                Weights[Surface] > Weights[Secondary])) {
+      Secondary = Surface;
+    }
+  }
+
+  Cell.PrimarySurface = static_cast<uint8>(Primary);
+  if (Secondary != INDEX_NONE && Weights[Secondary] > 0.0f) {
+    Cell.SecondarySurface = static_cast<uint8>(Secondary);
+    Cell.SecondaryWeight = static_cast<uint8>(
+        FMath::RoundToInt(255.0f * Weights[Secondary] / TotalWeight));
+  }
+  return Cell;
+}
+
+bool BakeMap(const FString &MapName, const FBakeOptions &Options) {
+  UWorld *World = LoadWorld(MapName);
+  if (!World) {
+    UE_LOG(LogPRAudio, Error, TEXT("[PRFoley] Could not load map %s"),
+           *MapName);
+    return false;
+  }
+  if (World->IsPartitionedWorld()) {
+    UE_LOG(LogPRAudio, Warning,
+           TEXT("[PRFoley] %s uses World Partition: only actors loaded with "
+                "the map are baked."),
+           *MapName);
+  }
+
+  bool bSaved = false;
+  const FBox Bounds = GetWalkableBounds(*World, Options.Channel);
+
+  FPRFoleySurfaceGridHeader Header;
+  Header.Magic = FPRFoleySurfaceGrid::FileMagic;
+  Header.Version = FPRFoleySurfaceGrid::FileVersion;
+  Header.CellSize = Options.CellSize;
+  if (Bounds.IsValid) {
+    const double CellSize = Options.CellSize;
+    Header.OriginX = FMath::FloorToDouble(Bounds.Min.X / CellSize) * CellSize;
+    Header.OriginY = FMath::FloorToDouble(Bounds.Min.Y / CellSize) * CellSize;
+    Header.SizeX = FMath::Max(
+        1, FMath::CeilToInt32((Bounds.Max.X - Header.OriginX) / CellSize));
+    Header.SizeY = FMath::Max(
+        1, FMath::CeilToInt32((Bounds.Max.Y - Header.OriginY) / CellSize));
+  }
+
+  const int64 NumCells = static_cast<int64>(Header.SizeX) * Header.SizeY;
+  if (!Bounds.IsValid) {
+    UE_LOG(LogPRAudio, Error, TEXT("[PRFoley] %s has no blocking geometry"),
+           *MapName);
+  } else if (NumCells > Options.MaxCells) {
+    UE_LOG(LogPRAudio, Error,
+           TEXT("[PRFoley] %s needs %lld cells (max %lld): raise -CellSize "
+                "or -MaxCells"),
+           *MapName, NumCells, Options.MaxCells);
+  } else {
+    UPRFoleyLandscapeSubsystem *Landscapes =
+        World->GetSubsystem<UPRFoleyLandscapeSubsystem>();
+    const float TopZ = Bounds.Max.Z + 10.0f;
+    const float BottomZ = Bounds.Min.Z - 10.0f;
+
+    TArray<FPRFoleySurfaceCell> Cells;
+    Cells.Reserve(NumCells);
+    int32 NumStatic = 0;
+    for (int32 Y = 0; Y < Header.SizeY; ++Y) {
+      if (Y % FMath::Max(1, Header.SizeY / 10) == 0) {
+        UE_LOG(LogPRAudio, Display, TEXT("[PRFoley] %s: %d%%"), *MapName,
+               100 * Y / Header.SizeY);
+      }
+      for (int32 X = 0; X < Header.SizeX; ++X) {
+        const FVector2D Center(Header.OriginX + (X + 0.5) * Header.CellSize,
+                               Header.OriginY + (Y + 0.5) * Header.CellSize);
+        const FPRFoleySurfaceCell &Cell =
+            Cells.Add_GetRef(BakeCell(*World, Landscapes, Center, TopZ,
+                                      BottomZ, Options));
+        NumStatic += Cell.IsStaticGround() ? 1 : 0;
+      }
+    }
+
+    const FString Filename = FPRFoleySurfaceGrid::GetFilenameForMap(MapName);
+    bSaved = FPRFoleySurfaceGrid::Save(Filename, Header, Cells);
+    UE_LOG(LogPRAudio, Display,
+           TEXT("[PRFoley] %s: %dx%d cells, %.1f%% static ground, %lld KB "
+                "-> %s%s"),
+           *MapName, Header.SizeX, Header.SizeY,
+           100.0f * NumStatic / FMath::Max<int64>(NumCells, 1),
+           (NumCells * sizeof(FPRFoleySurfaceCell)) / 1024, *Filename,
+           bSaved ? TEXT("") : TEXT(" (WRITE FAILED)"));
+  }
+
+  // Cooked weightmaps keep no CPU copy: bake them for the landscape
+  // subsystem as well
+  if (UPRFoleyLandscapeSubsystem *Landscapes =
+          World->GetSubsystem<UPRFoleyLandscapeSubsystem>()) {
+    const FString Filename =
+        UPRFoleyLandscapeSubsystem::GetBakedWeightsFilename(MapName);
+    const int32 NumBaked = Landscapes->SaveBakedWeights(*World, Filename);
+    if (NumBaked == INDEX_NONE) {
+      UE_LOG(LogPRAudio, Error, TEXT("[PRFoley] Could not write %s"),
+             *Filename);
+      bSaved = false;
+    } else if (NumBaked > 0) {
+      UE_LOG(LogPRAudio, Display,
+             TEXT("[PRFoley] %s: %d landscape components -> %s"), *MapName,
+             NumBaked, *Filename);
+    }
+  }
+
+  UnloadWorld(World);
+  return bSaved;
+}
+
+#endif // WITH_EDITOR
+
+} // namespace
+
+UPRFoleyBakeSurfaceGridCommandlet::UPRFoleyBakeSurfaceGridCommandlet() {
+  IsClient = false;
+  IsEditor = true;
+  IsServer = false;
+  LogToConsole = true;
+}
+
+int32 UPRFoleyBakeSurfaceGridCommandlet::Main(const FString &Params) {
+#if WITH_EDITOR
+  TArray<FString> Tokens;
+  TArray<FString> Switches;
+  TMap<FString, FString> Values;
+  ParseCommandLine(*Params, Tokens, Switches, Values);
+
+  FBakeOptions Options;
+  Options.CellSize = GetDefault<UPRFoleySettings>()->SurfaceGridCellSize;
+  if (const FString *Value = Values.Find(TEXT("CellSize"))) {
+    Options.CellSize = FMath::Max(FCString::Atof(**Value), 1.0f);
+  }
+  if (const FString *Value = Values.Find(TEXT("Channel"))) {
+    Options.Channel = static_cast<ECollisionChannel>(
+        FMath::Clamp(FCString::Atoi(**Value), 0, ECC_MAX - 1));
+  }
+  if (const FString *Value = Values.Find(TEXT("WalkableZ"))) {
+    Options.WalkableZ = FCString::Atof(**Value);
+  }
+  if (const FString *Value = Values.Find(TEXT("Headroom"))) {
+    Options.Headroom = FCString::Atof(**Value);
+  }
+  if (const FString *Value = Values.Find(TEXT("StepHeight"))) {
+    Options.StepHeight = FCString::Atof(**Value);
+  }
+  if (const FString *Value = Values.Find(TEXT("MaxCells"))) {
+    Options.MaxCells = FCString::Atoi64(**Value);
+  }
+
+  TArray<FString> Maps;
+  Values.FindRef(TEXT("Map")).ParseIntoArray(Maps, TEXT("+"));
+  if (Maps.Num() == 0) {
+    UE_LOG(LogPRAudio, Error,
+           TEXT("[PRFoley] Usage: -run=PRFoleyBakeSurfaceGrid "
+                "-Map=/Game/Maps/A+/Game/Maps/B [-CellSize=50]"));
+    return 1;
+  }
+
+  int32 NumFailed = 0;
+  for (const FString &Map : Maps) {
+    NumFailed += BakeMap(Map, Options) ? 0 : 1;
+  }
+  return NumFailed > 0 ? 1 : 0;
+#else
+  UE_LOG(LogPRAudio, Error,
+         TEXT("[PRFoley] PRFoleyBakeSurfaceGrid needs an editor build."));
+  return 1;
+#endif
+}
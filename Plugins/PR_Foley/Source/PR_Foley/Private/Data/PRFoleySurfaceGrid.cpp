@@ -0,0 +1,127 @@
+#include "Data/PRFoleySurfaceGrid.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "PRAudioLog.h"
+
+FVector FPRFoleySurfaceCell::GetNormal() const {
+  const float X = NormalX / 127.0f;
+  const float Y = NormalY / 127.0f;
+  return FVector(X, Y, FMath::Sqrt(FMath::Max(0.0f, 1.0f - X * X - Y * Y)));
+}
+
+FPRFoleySurfaceGrid::FPRFoleySurfaceGrid() = default;
+
+FPRFoleySurfaceGrid::~FPRFoleySurfaceGrid() { Reset(); }
+
+FString FPRFoleySurfaceGrid::GetFilenameForMap(const FString &MapPackageName) {
+  return FPackageName::LongPackageNameToFilename(MapPackageName,
+                                                 TEXT(".pfgrid"));
+}
+
+// ============================================================================
+// Save / Load
+// ============================================================================
+
+bool FPRFoleySurfaceGrid::Save(const FString &Filename,
+                               const FPRFoleySurfaceGridHeader &Header,
+                               TConstArrayView<FPRFoleySurfaceCell> Cells) {
+  if (static_cast<int64>(Header.SizeX) * Header.SizeY != Cells.Num()) {
+    return false;
+  }
+
+  TArray64<uint8> Data;
+  Data.Reserve(sizeof(Header) + Cells.NumBytes());
+  Data.Append(reinterpret_cast<const uint8 *>(&Header), sizeof(Header));
+  Data.Append(reinterpret_cast<const uint8 *>(Cells.GetData()),
+              Cells.NumBytes());
+  return FFileHelper::SaveArrayToFile(Data, *Filename);
+}
+
+bool FPRFoleySurfaceGrid::Load(const FString &Filename) {
+  Reset();
+
+  IPlatformFile &PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+  if (!PlatformFile.FileExists(*Filename)) {
+    return false;
+  }
+
+  const uint8 *Data = nullptr;
+  int64 Size = 0;
+
+  FOpenMappedResult Mapped = PlatformFile.OpenMappedEx(*Filename);
+  if (Mapped.HasValue()) {
+    MappedFile = Mapped.StealValue();
+    MappedRegion.Reset(MappedFile->MapRegion());
+  }
+  if (MappedRegion.IsValid()) {
+    Data = MappedRegion->GetMappedPtr();
+    Size = MappedRegion->GetMappedSize();
+  } else {
+    // Paks and some platforms cannot map: read it instead
+    MappedFile.Reset();
+    if (!FFileHelper::LoadFileToArray(FileData, *Filename)) {
+      return false;
+    }
+    Data = FileData.GetData();
+    Size = FileData.Num();
+  }
+
+  if (Size < static_cast<int64>(sizeof(Header))) {
+    Reset();
+    return false;
+  }
+  FMemory::Memcpy(&Header, Data, sizeof(Header));
+
+  const int64 NumCells = static_cast<int64>(Header.SizeX) * Header.SizeY;
+  if (Header.Magic != FileMagic || Header.Version != FileVersion ||
+      Header.CellSize <= 0.0f || Header.SizeX <= 0 || Header.SizeY <= 0 ||
+      Size < static_cast<int64>(sizeof(Header)) +
+                 NumCells * static_cast<int64>(sizeof(FPRFoleySurfaceCell))) {
+    UE_LOG(LogPRAudio, Warning,
+           TEXT("[PRFoley] Invalid or outdated surface grid: %s"), *Filename);
+    Reset();
+    return false;
+  }
+
+  Cells = reinterpret_cast<const FPRFoleySurfaceCell *>(Data + sizeof(Header));
+  return true;
+}
+
+void FPRFoleySurfaceGrid::Reset() {
+  Cells = nullptr;
+  Header = FPRFoleySurfaceGridHeader();
+  // The region must be unmapped before its file handle is closed
+  MappedRegion.Reset();
+  MappedFile.Reset();
+  FileData.Empty();
+}
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+const FPRFoleySurfaceCell *
+FPRFoleySurfaceGrid::FindCell(const FVector &Location) const {
+  if (!Cells) {
+    return nullptr;
+  }
+  const int32 X =
+      FMath::FloorToInt32((Location.X - Header.OriginX) / Header.CellSize);
+  const int32 Y =
+      FMath::FloorToInt32((Location.Y - Header.OriginY) / Header.CellSize);
+  if (X < 0 || Y < 0 || X >= Header.SizeX || Y >= Header.SizeY) {
+    return nullptr;
+  }
+  return &Cells[static_cast<int64>(Y) * Header.SizeX + X];
+}
+
+FVector2D FPRFoleySurfaceGrid::GetCellCenter(const FVector &Location) const {
+  const double X = FMath::FloorToDouble((Location.X - Header.OriginX) /
+                                        Header.CellSize);
+  const double Y = FMath::FloorToDouble((Location.Y - Header.OriginY) /
+                                        Header.CellSize);
+  return FVector2D(Header.OriginX + (X + 0.5) * Header.CellSize,
+                   Header.OriginY + (Y + 0.5) * Header.CellSize);
+}
@@ -0,0 +1,82 @@
+#include "Data/PRFoleyTypes.h"
+
+namespace {
+constexpr uint32 NumEventBits = 11;
+constexpr int32 OffsetRange = 512;
+
+/** Time offsets in 4 ms ticks: 8 bits cover a 1 Hz net update. */
+constexpr float TimeTicksPerSecond = 250.0f;
+constexpr uint32 NumTimeBits = 8;
+
+static_assert(SurfaceType_Max <= 64, "Surface no longer fits in 6 bits");
+} // namespace
+
+bool FPRFoleyNetEventBatch::NetSerialize(FArchive &Ar, UPackageMap *Map,
+                                         bool &bOutSuccess) {
+  bOutSuccess = SerializePackedVector<1, 24>(Origin, Ar);
+
+  uint32 NumEvents = FMath::Min(Events.Num(), MaxEvents);
+  Ar.SerializeInt(NumEvents, MaxEvents + 1);
+  if (Ar.IsLoading()) {
+    Events.SetNum(FMath::Min<int32>(NumEvents, MaxEvents));
+  }
+
+  for (int32 Index = 0; Index < static_cast<int32>(NumEvents); ++Index) {
+    FPRFoleyNetEvent &Event = Events[Index];
+
+    // Surface (6) | event type (2) | velocity tier (2) | heavy land (1)
+    uint32 Bits = static_cast<uint32>(Event.Surface) |
+                  static_cast<uint32>(Event.EventType) << 6 |
+                  static_cast<uint32>(Event.VelocityTier) << 8 |
+                  static_cast<uint32>(Event.bHeavyLand) << 10;
+    Ar.SerializeBits(&Bits, NumEventBits);
+
+    // Feet are close to the actor: 10 bits per axis covers +-5 m at 1 cm
+    const FVector Offset = Event.Location - Origin;
+    uint8 bNear = Offset.GetAbsMax() < OffsetRange - 1;
+    Ar.SerializeBits(&bNear, 1);
+    if (bNear) {
+      FVector Quantized = Offset;
+      for (int32 Axis = 0; Axis < 3; ++Axis) {
+        uint32 Value = static_cast<uint32>(
+            FMath::RoundToInt32(Offset[Axis]) + OffsetRange);
+        Ar.SerializeInt(Value, OffsetRange * 2);
+        Quantized[Axis] = static_cast<double>(Value) - OffsetRange;
+      }
+      if (Ar.IsLoading()) {
+        Event.Location = Origin + Quantized;
+      }
+    } else {
+      bOutSuccess &= SerializePackedVector<1, 24>(Event.Location, Ar);
+    }
+
+    // Ground normals face up: X and Y are enough
+    int8 NormalX = static_cast<int8>(
+        FMath::RoundToInt32(FMath::Clamp(Event.Normal.X, -1.0, 1.0) * 127.0));
+    int8 NormalY = static_cast<int8>(
+        FMath::RoundToInt32(FMath::Clamp(Event.Normal.Y, -1.0, 1.0) * 127.0));
+    Ar << NormalX << NormalY;
+
+    uint32 TimeTicks = static_cast<uint32>(
+        FMath::Clamp(FMath::RoundToInt32(Event.TimeOffset * TimeTicksPerSecond),
+                     0, (1 << NumTimeBits) - 1));
+    Ar.SerializeBits(&TimeTicks, NumTimeBits);
+
+    if (Ar.IsLoading()) {
+      Event.TimeOffset = TimeTicks / TimeTicksPerSecond;
+
+      Event.Surface = static_cast<EPhysicalSurface>(Bits & 0x3F);
+      Event.EventType = static_cast<EPRFoleyEventType>((Bits >> 6) & 0x3);
+      Event.VelocityTier = static_cast<EPRVelocityTier>((Bits >> 8) & 0x3);
+      Event.bHeavyLand = ((Bits >> 10) & 0x1) != 0;
+
+      const double X = NormalX / 127.0;
+      const double Y = NormalY / 127.0;
+      Event.Normal =
+          FVector(X, Y, FMath::Sqrt(FMath::Max(0.0, 1.0 - X * X - Y * Y)));
+    }
+  }
+
+  bOutSuccess &= !Ar.IsError();
+  return bOutSuccess;
+}
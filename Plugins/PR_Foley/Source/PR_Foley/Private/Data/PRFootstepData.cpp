@@ -0,0 +1,171 @@
+#include "Data/PRFootstepData.h"
+
+UPRFootstepData::UPRFootstepData() {
+  TraceLength = 150.0f;
+  FootIntervalDistance = 120.0f;
+
+  // Default biped setup
+  FootSockets = {FName("foot_l"), FName("foot_r")};
+}
+
+FPrimaryAssetId UPRFootstepData::GetPrimaryAssetId() const {
+  return FPrimaryAssetId("FootstepData", GetFName());
+}
+
+void UPRFootstepData::PostLoad() {
+  Super::PostLoad();
+  BuildSurfaceLookup();
+}
+
+#if WITH_EDITOR
+void UPRFootstepData::PostEditChangeProperty(
+    FPropertyChangedEvent &PropertyChangedEvent) {
+  Super::PostEditChangeProperty(PropertyChangedEvent);
+  // Any edit can reorder Surfaces, so always rebake.
+  BuildSurfaceLookup();
+}
+#endif
+
+// ============================================================================
+// Surface Lookup
+// ============================================================================
+
+FPRResolvedSurface
+UPRFootstepData::GetResolvedSurface(EPhysicalSurface Surface) const {
+  const int32 SurfaceIndex = static_cast<int32>(Surface);
+  if (SurfaceIndex >= SurfaceType_Max) {
+    Surface = SurfaceType_Default;
+  }
+
+  // Baked index when it still matches Surfaces, else resolve it again
+  int32 ConfigIndex = SurfaceConfigIndices[static_cast<int32>(Surface)];
+  bool bDefault = false;
+  if (IsBakedConfigValid(ConfigIndex, Surface)) {
+    bDefault = ConfigIndex != INDEX_NONE &&
+               Surfaces[ConfigIndex].Surface.GetValue() != Surface;
+  } else {
+    ConfigIndex = FindSurfaceConfig(Surface);
+    if (ConfigIndex == INDEX_NONE) {
+      ConfigIndex = FindSurfaceConfig(SurfaceType_Default);
+      bDefault = true;
+    }
+  }
+
+  const FPRSurfaceFoleyConfig *Config =
+      ConfigIndex != INDEX_NONE ? &Surfaces[ConfigIndex] : nullptr;
+  const EPhysicalSurface ConfigKey = bDefault ? SurfaceType_Default : Surface;
+
+  FPRResolvedSurface Resolved;
+  Resolved.Config = Config;
+  Resolved.VolumeRange = SurfaceAudio.VolumeRange;
+  Resolved.PitchRange = SurfaceAudio.PitchRange;
+
+  // Jump/Land fall back to the global sets (shared shuffle history)
+  Resolved.JumpLaunch = &GlobalJumpLaunch;
+  Resolved.LandImpact = &GlobalLandImpact;
+
+  if (Config) {
+    Resolved.Footstep = &Config->Footstep;
+    Resolved.FootstepKey = ConfigKey;
+    Resolved.VolumeRange *= Config->VolumeMultiplier;
+    Resolved.PitchRange *= Config->PitchMultiplier;
+
+    if (Config->bOverrideJump) {
+      Resolved.JumpLaunch = &Config->JumpLaunch;
+      Resolved.JumpKey = ConfigKey;
+    }
+    if (Config->bOverrideLand) {
+      Resolved.LandImpact = &Config->LandImpact;
+      Resolved.LandKey = ConfigKey;
+    }
+
+    const FPRSurfaceVFXSet &SurfVFX = Config->VFX;
+    if (!SurfVFX.FootstepVFX.IsNull() || !SurfVFX.JumpVFX.IsNull() ||
+        !SurfVFX.LandVFX.IsNull()) {
+      Resolved.VFX = &SurfVFX;
+    }
+
+    if (!Config->Decal.DecalMaterial.IsNull()) {
+      Resolved.Decal = &Config->Decal;
+    }
+  }
+
+  if (!Resolved.VFX &&
+      (!DefaultVFX.FootstepVFX.IsNull() || !DefaultVFX.JumpVFX.IsNull() ||
+       !DefaultVFX.LandVFX.IsNull())) {
+    Resolved.VFX = &DefaultVFX;
+  }
+  if (!Resolved.Decal && !DefaultDecal.DecalMaterial.IsNull()) {
+    Resolved.Decal = &DefaultDecal;
+  }
+  return Resolved;
+}
+
+void UPRFootstepData::BuildSurfaceLookup() {
+  // First entry wins, matching the order designers see in the editor.
+  TStaticArray<int32, SurfaceType_Max> ExactIndices(InPlace, INDEX_NONE);
+  for (int32 ConfigIndex = 0; ConfigIndex < Surfaces.Num(); ++ConfigIndex) {
+    const int32 Index =
+        static_cast<int32>(Surfaces[ConfigIndex].Surface.GetValue());
+    if (Index < SurfaceType_Max && ExactIndices[Index] == INDEX_NONE) {
+      ExactIndices[Index] = ConfigIndex;
+    }
+  }
+
+  for (int32 Index = 0; Index < SurfaceType_Max; ++Index) {
+    SurfaceConfigIndices[Index] = ExactIndices[Index] != INDEX_NONE
+                                      ? ExactIndices[Index]
+                                      : ExactIndices[SurfaceType_Default];
+  }
+  BakedSurfaceCount = Surfaces.Num();
+}
+
+int32 UPRFootstepData::FindSurfaceConfig(EPhysicalSurface Surface) const {
+  return Surfaces.IndexOfByPredicate(
+      [Surface](const FPRSurfaceFoleyConfig &Entry) {
+        return Entry.Surface.GetValue() == Surface;
+      });
+}
+
+bool UPRFootstepData::IsBakedConfigValid(int32 ConfigIndex,
+                                         EPhysicalSurface Surface) const {
+  if (BakedSurfaceCount != Surfaces.Num()) {
+    return false;
+  }
+  if (ConfigIndex == INDEX_NONE) {
+    return true;
+  }
+  // Exact entry, or the Default fallback baked for a surface without one
+  const EPhysicalSurface Baked = Surfaces[ConfigIndex].Surface.GetValue();
+  return Baked == Surface || Baked == SurfaceType_Default;
+}
+
+void UPRFootstepData::GetSurfaceAssetPaths(
+    EPhysicalSurface Surface, TArray<FSoftObjectPath> &OutPaths) const {
+  const FPRResolvedSurface Resolved = GetResolvedSurface(Surface);
+
+  auto AddPath = [&OutPaths](const FSoftObjectPath &Path) {
+    if (!Path.IsNull()) {
+      OutPaths.AddUnique(Path);
+    }
+  };
+
+  for (const FPRSurfaceSoundSet *SoundSet :
+       {Resolved.Footstep, Resolved.JumpLaunch, Resolved.LandImpact}) {
+    if (SoundSet) {
+      for (const TSoftObjectPtr<USoundBase> &Sound : SoundSet->Sounds) {
+        AddPath(Sound.ToSoftObjectPath());
+      }
+    }
+  }
+
+  if (Resolved.VFX) {
+    AddPath(Resolved.VFX->FootstepVFX.ToSoftObjectPath());
+    AddPath(Resolved.VFX->JumpVFX.ToSoftObjectPath());
+    AddPath(Resolved.VFX->LandVFX.ToSoftObjectPath());
+  }
+
+  if (Resolved.Decal) {
+    AddPath(Resolved.Decal->DecalMaterial.ToSoftObjectPath());
+  }
+}
@@ -1,31 +1,66 @@
 #include "PRFoleyComponent.h"
+#include "AudioParameter.h"
 #include "Components/AudioComponent.h"
-#include "Components/DecalComponent.h"
-#include "Components/InstancedStaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/Engine.h" // For GEngine
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
+#include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
-#include "LandscapeComponent.h"
-#include "LandscapeHeightfieldCollisionComponent.h"
-#include "LandscapeLayerInfoObject.h"
 #include "LandscapeProxy.h" // For Landscape detection
 #include "Modules/ModuleManager.h"
 #include "Net/UnrealNetwork.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 #include "PRAudioLog.h"
+#include "PRFoleySettings.h"
+#include "PRFoleyStats.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Sound/SoundAttenuation.h"
+#include "Sound/SoundWave.h"
+#include "Subsystems/PRFoleyAudioPoolSubsystem.h"
+#include "Subsystems/PRFoleyDecalPoolSubsystem.h"
+#include "Subsystems/PRFoleyDistanceSubsystem.h"
+#include "Subsystems/PRFoleyFootprintSubsystem.h"
+#include "Subsystems/PRFoleyLandscapeSubsystem.h"
+#include "Subsystems/PRFoleyNetRelaySubsystem.h"
+#include "Subsystems/PRFoleyNoiseSubsystem.h"
+#include "Subsystems/PRFoleySignificanceSubsystem.h"
+#include "Subsystems/PRFoleyStreamingSubsystem.h"
+#include "Subsystems/PRFoleySurfaceGridSubsystem.h"
+#include "Subsystems/PRFoleyTraceSubsystem.h"
 #include "WorldCollision.h" // Correct header for FOverlapResult
 
+DECLARE_CYCLE_STAT(TEXT("TriggerFootstep"), STAT_PRFoley_TriggerFootstep,
+                   STATGROUP_PRFoley);
+DECLARE_CYCLE_STAT(TEXT("PerformTrace"), STAT_PRFoley_PerformTrace,
+                   STATGROUP_PRFoley);
+DECLARE_CYCLE_STAT(TEXT("GetLandscapeBlendSurface"),
+                   STAT_PRFoley_LandscapeBlend, STATGROUP_PRFoley);
+DECLARE_CYCLE_STAT(TEXT("PlaySoundWithSettings"), STAT_PRFoley_PlaySound,
+                   STATGROUP_PRFoley);
+DECLARE_CYCLE_STAT(TEXT("SpawnVFX"), STAT_PRFoley_SpawnVFX, STATGROUP_PRFoley);
+DECLARE_CYCLE_STAT(TEXT("SpawnFootprintDecal"), STAT_PRFoley_SpawnDecal,
+                   STATGROUP_PRFoley);
+DECLARE_CYCLE_STAT(TEXT("UpdateBreathingMetaSound"),
+                   STAT_PRFoley_UpdateBreathingMetaSound, STATGROUP_PRFoley);
+
 #if WITH_EDITOR
 #include "AssetRegistry/AssetRegistryModule.h"
 #endif
 
+namespace {
+/** A movement hit can stand in for a foley trace if its surface is known. */
+bool IsUsableFloorHit(const FHitResult &Hit) {
+  return Hit.bBlockingHit &&
+         (Hit.PhysMaterial.IsValid() ||
+          (Hit.GetActor() && Hit.GetActor()->IsA<ALandscapeProxy>()));
+}
+} // namespace
+
 // ============================================================================
 // Constructor
 // ============================================================================
@@ -55,22 +90,29 @@ void UPRFoleyComponent::BeginPlay() {
   Super::BeginPlay();
   CacheOwnerMesh();
 
-  // Initialize Distance Mode state
-  if (GetOwner()) {
-    LastLocation = GetOwner()->GetActorLocation();
-  }
+  // Shared by every trace: built once instead of per query
+  FoleyQueryParams =
+      FCollisionQueryParams(SCENE_QUERY_STAT(PRFoleyTrace), false, GetOwner());
+  FoleyQueryParams.bReturnPhysicalMaterial = true;
 
-  bool bTickEnabled = false;
+  bServerStripped = GetNetMode() == NM_DedicatedServer &&
+                    GetDefault<UPRFoleySettings>()->bStripDedicatedServer;
 
-  if (FootstepData) {
-    // Enable Tick if in Distance Mode (any active step-driven layer)
-    if (FootstepData->TriggerMode == EPRFootstepTriggerMode::Distance &&
-        (bEnableFootstepLayer || bEnableVoiceLayer)) {
-      SetComponentTickEnabled(true);
-      bTickEnabled = true;
-      // Init local interval
-      InstanceDistanceInterval = FootstepData->FootIntervalDistance;
+  if (UWorld *World = GetWorld()) {
+    if (UPRFoleySignificanceSubsystem *SignificanceSubsystem =
+            World->GetSubsystem<UPRFoleySignificanceSubsystem>()) {
+      SignificanceSubsystem->RegisterComponent(this);
     }
+  }
+
+  if (FootstepData) {
+    InstanceDistanceInterval = FootstepData->FootIntervalDistance;
+
+    // Distance Mode is driven by the world subsystem, not by our tick
+    UpdateDistanceRegistration();
+
+    PinDefaultSurface();
+    RequestMovementMaterials();
 
     // Auto Bind to Landed
     if (FootstepData->bAutoTriggerLand) {
@@ -89,13 +131,45 @@ void UPRFoleyComponent::BeginPlay() {
     }
   }
 
-  if (bEnableVoiceLayer && VoiceData &&
+  // Breathing is the only thing we tick for; nobody hears it on a server
+  if (!IsServerStripped() && bEnableVoiceLayer && VoiceData &&
       (VoiceData->BreathingLoops.Num() > 0 || VoiceData->BreathingMetaSound)) {
-    if (!bTickEnabled) {
-      SetComponentTickEnabled(true);
-    }
+    bHasBreathing = true;
+    // Starts silent under a voice budget until the first ranking
+    bBreathingVirtual =
+        GetDefault<UPRFoleySettings>()->MaxRealBreathingVoices > 0;
+    SetComponentTickEnabled(true);
+    PrimeBreathingLoops();
     UpdateBreathingLoop();
   }
+
+  PrewarmSounds();
+}
+
+// ============================================================================
+// EndPlay
+// ============================================================================
+
+void UPRFoleyComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  StopFootstepVoice();
+  UnpinDefaultSurface();
+
+  PendingNetEvents.Reset();
+  NextNetEvent = 0;
+
+  if (UWorld *World = GetWorld()) {
+    World->GetTimerManager().ClearTimer(NetFlushTimerHandle);
+    if (UPRFoleyDistanceSubsystem *DistanceSubsystem =
+            World->GetSubsystem<UPRFoleyDistanceSubsystem>()) {
+      DistanceSubsystem->UnregisterComponent(this);
+    }
+    if (UPRFoleySignificanceSubsystem *SignificanceSubsystem =
+            World->GetSubsystem<UPRFoleySignificanceSubsystem>()) {
+      SignificanceSubsystem->UnregisterComponent(this);
+    }
+  }
+
+  Super::EndPlay(EndPlayReason);
 }
 
 // ============================================================================
@@ -110,7 +184,22 @@ void UPRFoleyComponent::OnComponentCreated() {
 }
 #endif
 
-void UPRFoleyComponent::OnLanded(const FHitResult &Hit) { Landing(); }
+void UPRFoleyComponent::OnLanded(const FHitResult &Hit) {
+  // Simulated proxies get lands from the server's multicast
+  if (UsesLocalSimulation() && GetOwnerRole() == ROLE_SimulatedProxy) {
+    return;
+  }
+
+  // The landing sweep already found the ground: no need to trace again
+  if (FootstepData && FootstepData->bUseMovementFloor &&
+      IsUsableFloorHit(Hit)) {
+    LastFloorHit = Hit;
+    HandleLand(Hit, GetOwner() ? FMath::Abs(GetOwner()->GetVelocity().Z)
+                               : 0.0f);
+    return;
+  }
+  Landing();
+}
 
 void UPRFoleyComponent::OnMovementModeChanged(ACharacter *Character,
                                               EMovementMode PrevMode,
@@ -162,57 +251,42 @@ void UPRFoleyComponent::TickComponent(
     return;
   }
 
-  if (bEnableVoiceLayer || BreathingComp_A || BreathingComp_B) {
-    UpdateBreathingLoop();
+  // DeltaTime spans the whole tick interval set by UpdateBreathingSchedule
+  if (bEnableVoiceLayer || BreathingComp_A || BreathingLoopComps.Num() > 0) {
+    UpdateBreathingLoop(DeltaTime);
   }
+}
 
-  // Early out if Data invalid or Mode is NOT Distance
-  if (!FootstepData) {
-    return;
-  }
-  if (FootstepData->TriggerMode != EPRFootstepTriggerMode::Distance) {
-    return;
-  }
-  if (!bEnableFootstepLayer && !bEnableVoiceLayer) {
-    return;
-  }
+// ============================================================================
+// Distance Mode
+// ============================================================================
 
-  // LOD Check (Tick Optimization)
-  if (FootstepData->MaxLODDistance > 0.0f) {
-    if (APlayerCameraManager *CamManager =
-            UGameplayStatics::GetPlayerCameraManager(this, 0)) {
-      float DistSq = FVector::DistSquared(CamManager->GetCameraLocation(),
-                                          GetOwner()->GetActorLocation());
-      if (DistSq > FMath::Square(FootstepData->MaxLODDistance)) {
-        LastLocation = GetOwner()->GetActorLocation();
-        return;
-      }
-    }
+void UPRFoleyComponent::UpdateDistanceRegistration() {
+  UWorld *World = GetWorld();
+  UPRFoleyDistanceSubsystem *DistanceSubsystem =
+      World ? World->GetSubsystem<UPRFoleyDistanceSubsystem>() : nullptr;
+  if (!DistanceSubsystem) {
+    return;
   }
 
-  // Calculate distance traveled
-  FVector CurrentLocation = GetOwner()->GetActorLocation();
-  double Dist = FVector::Dist(CurrentLocation, LastLocation);
-
-  if (Dist > 0.1) {
-    AccumulatedDistance += Dist;
+  if (FootstepData &&
+      FootstepData->TriggerMode == EPRFootstepTriggerMode::Distance) {
+    DistanceSubsystem->RegisterComponent(this);
+  } else {
+    DistanceSubsystem->UnregisterComponent(this);
   }
+}
 
-  LastLocation = CurrentLocation;
-
-  // Check if distance interval reached
-  if (InstanceDistanceInterval > 0.0f &&
-      AccumulatedDistance >= InstanceDistanceInterval) {
-    AccumulatedDistance -= InstanceDistanceInterval;
+void UPRFoleyComponent::TriggerDistanceFootstep(int32 FootIndex,
+                                                const FVector &Offset,
+                                                float StartDelay) {
+  TGuardValue<FVector> OffsetGuard(StepLocationOffset, Offset);
+  TGuardValue<float> DelayGuard(StepStartDelay, StartDelay);
 
-    if (FootstepData->FootSockets.Num() > 0) {
-      CurrentFootIndex =
-          (CurrentFootIndex + 1) % FootstepData->FootSockets.Num();
-      FName NextSocket = FootstepData->FootSockets[CurrentFootIndex];
-      TriggerFootstep(NextSocket);
-    } else {
-      TriggerFootstep(NAME_None);
-    }
+  if (FootstepData && FootstepData->FootSockets.IsValidIndex(FootIndex)) {
+    TriggerFootstep(FootstepData->FootSockets[FootIndex]);
+  } else {
+    TriggerFootstep(NAME_None);
   }
 }
 
@@ -329,6 +403,9 @@ void UPRFoleyComponent::AutoAssignVoiceData() {
 
 void UPRFoleyComponent::SetFootIntervalDistance(float NewInterval) {
   InstanceDistanceInterval = NewInterval;
+  if (HasBegunPlay()) {
+    UpdateDistanceRegistration();
+  }
   UE_LOG(LogPRAudio, Verbose,
          TEXT("[PRFoley] Updated Instance Distance Interval to: %f"),
          NewInterval);
@@ -360,7 +437,7 @@ EPhysicalSurface UPRFoleyComponent::GetLastDetectedSurface() const {
 }
 
 float UPRFoleyComponent::GetBreathingIntensity() const {
-  return CachedBreathingIntensity;
+  return BreathingIntensity;
 }
 
 void UPRFoleyComponent::SetBreathingIntensityOverride(float Intensity) {
@@ -372,21 +449,86 @@ void UPRFoleyComponent::ClearBreathingIntensityOverride() {
 }
 
 void UPRFoleyComponent::SetFootstepData(UPRFootstepData *NewData) {
+  // The voice was spawned with the old asset's MetaSound and audio settings
+  if (NewData != FootstepData) {
+    StopFootstepVoice();
+  }
   FootstepData = NewData;
   if (FootstepData) {
     InstanceDistanceInterval = FootstepData->FootIntervalDistance;
   }
+  if (HasBegunPlay()) {
+    UpdateDistanceRegistration();
+    PinDefaultSurface();
+    RequestMovementMaterials();
+    PrewarmSounds();
+  }
 }
 
-void UPRFoleyComponent::SetVoiceData(UPRVoiceData *NewData) {
-  // Fade out current breathing before swap
-  if (BreathingComp_A && BreathingComp_A->IsPlaying()) {
-    BreathingComp_A->FadeOut(0.5f, 0.0f);
+void UPRFoleyComponent::PinDefaultSurface() {
+  if (PinnedFootstepData == FootstepData) {
+    return;
+  }
+  UnpinDefaultSurface();
+
+  UWorld *World = GetWorld();
+  if (!World || !FootstepData || IsServerStripped()) {
+    return;
+  }
+  if (UPRFoleyStreamingSubsystem *Streaming =
+          World->GetSubsystem<UPRFoleyStreamingSubsystem>()) {
+    Streaming->RequestSurface(FootstepData, SurfaceType_Default, true);
+    PinnedFootstepData = FootstepData;
   }
-  if (BreathingComp_B && BreathingComp_B->IsPlaying()) {
-    BreathingComp_B->FadeOut(0.5f, 0.0f);
+}
+
+void UPRFoleyComponent::UnpinDefaultSurface() {
+  if (!PinnedFootstepData) {
+    return;
+  }
+  if (UWorld *World = GetWorld()) {
+    if (UPRFoleyStreamingSubsystem *Streaming =
+            World->GetSubsystem<UPRFoleyStreamingSubsystem>()) {
+      Streaming->UnpinSurface(PinnedFootstepData, SurfaceType_Default);
+    }
+  }
+  PinnedFootstepData = nullptr;
+}
+
+void UPRFoleyComponent::PrewarmSounds() {
+  UWorld *World = GetWorld();
+  if (!World || IsServerStripped() ||
+      !GetDefault<UPRFoleySettings>()->bPrewarmSounds) {
+    return;
+  }
+  UPRFoleyStreamingSubsystem *Streaming =
+      World->GetSubsystem<UPRFoleyStreamingSubsystem>();
+  if (!Streaming) {
+    return;
+  }
+
+  Streaming->PrewarmFootstepData(FootstepData);
+
+  if (VoiceData && bEnableVoiceLayer) {
+    TArray<USoundBase *, TInlineAllocator<8>> Sounds = {
+        VoiceData->JumpEffort, VoiceData->LandExhale,
+        VoiceData->HeavyLandExhale, VoiceData->BreathingMetaSound};
+    for (const TPair<EPRVelocityTier, TObjectPtr<USoundBase>> &Loop :
+         VoiceData->BreathingLoops) {
+      Sounds.Add(Loop.Value);
+    }
+    Streaming->PrewarmSounds(Sounds);
   }
+}
+
+void UPRFoleyComponent::SetVoiceData(UPRVoiceData *NewData) {
+  // Fade out current breathing before swap
+  FadeOutBreathing(0.5f);
   VoiceData = NewData;
+  if (HasBegunPlay()) {
+    PrimeBreathingLoops();
+    PrewarmSounds();
+  }
 }
 
 void UPRFoleyComponent::SetSpeedOverride(float Speed) { SpeedOverride = Speed; }
@@ -414,6 +556,9 @@ void UPRFoleyComponent::SetBreathingDrive(float NormalizedIntensity) {
 // ============================================================================
 
 void UPRFoleyComponent::TriggerFootstep(FName SocketName) {
+  SCOPE_CYCLE_COUNTER(STAT_PRFoley_TriggerFootstep);
+  TRACE_CPUPROFILER_EVENT_SCOPE(PRFoley_TriggerFootstep);
+
   if (!FootstepData) {
     UE_LOG(LogPRAudio, Error, TEXT("[PRFoley] FootstepData is NULL!"));
     return;
@@ -424,20 +569,40 @@ void UPRFoleyComponent::TriggerFootstep(FName SocketName) {
     return;
   }
 
-  if (!IsInLODRadius()) {
+  // Local simulation: only lands leave the server, unless AI listens
+  if (!ShouldDetectEvents() ||
+      (IsServerStripped() && UsesLocalSimulation() &&
+       !FootstepData->bReportAINoise)) {
     return;
   }
 
   if (!bEnableFootstepLayer) {
-    const FVector OwnerLocation =
-        GetOwner() ? GetOwner()->GetActorLocation() : FVector::ZeroVector;
-    PlayFootstepSound(SurfaceType_Default, OwnerLocation);
+    if (PresentsEvents()) {
+      const FVector OwnerLocation =
+          GetOwner() ? GetOwner()->GetActorLocation() : FVector::ZeroVector;
+      PlayFootstepSound(SurfaceType_Default, OwnerLocation);
+    }
     return;
   }
 
   FHitResult Hit;
   FVector StartLocation = FVector::ZeroVector;
   FVector EndLocation = FVector::ZeroVector;
+
+  if (ShouldUseAsyncTrace()) {
+    if (!ComputeFootstepTrace(SocketName, StartLocation, EndLocation)) {
+      return;
+    }
+    if (FindGroundWithoutTrace(SocketName, StartLocation, EndLocation, Hit)) {
+      LastHitNormal = Hit.ImpactNormal;
+      HandleFootstep(Hit);
+    } else {
+      RequestAsyncTrace(StartLocation, EndLocation,
+                        EPRFoleyEventType::Footstep);
+    }
+    return;
+  }
+
   if (TraceFootstep(SocketName, Hit, StartLocation, EndLocation)) {
     LastHitNormal = Hit.ImpactNormal;
     HandleFootstep(Hit);
@@ -452,12 +617,17 @@ void UPRFoleyComponent::TriggerFootstep(FName SocketName) {
 // ============================================================================
 
 void UPRFoleyComponent::Landing() {
-  if (!IsInLODRadius()) {
+  if (!ShouldDetectEvents()) {
     return;
   }
 
+  // Captured now: an async land resolves a frame later, after the velocity
+  // has been zeroed by the movement component.
+  const float FallSpeed =
+      GetOwner() ? FMath::Abs(GetOwner()->GetVelocity().Z) : 0.0f;
+
   if (!FootstepData || !bEnableFootstepLayer) {
-    HandleLand(FHitResult());
+    HandleLand(FHitResult(), FallSpeed);
     return;
   }
 
@@ -466,10 +636,15 @@ void UPRFoleyComponent::Landing() {
   Start.Z += ZOffset;
   FVector End = Start - FVector(0, 0, FootstepData->TraceLength * 2.0f);
 
+  if (ShouldUseAsyncTrace() &&
+      RequestAsyncTrace(Start, End, EPRFoleyEventType::Land, FallSpeed)) {
+    return;
+  }
+
   FHitResult Hit;
   if (PerformTrace(Start, End, Hit)) {
     LastHitNormal = Hit.ImpactNormal;
-    HandleLand(Hit);
+    HandleLand(Hit, FallSpeed);
     return;
   }
 
@@ -478,7 +653,7 @@ void UPRFoleyComponent::Landing() {
            Start.Z);
   }
 
-  HandleLand(FHitResult());
+  HandleLand(FHitResult(), FallSpeed);
 }
 
 // ============================================================================
@@ -486,11 +661,14 @@ void UPRFoleyComponent::Landing() {
 // ============================================================================
 
 void UPRFoleyComponent::HandleJump() {
-  if (!IsInLODRadius()) {
+  if (!ShouldDetectEvents() ||
+      (IsServerStripped() && UsesLocalSimulation() &&
+       !(FootstepData && FootstepData->bReportAINoise))) {
     return;
   }
 
-  if (bEnableVoiceLayer && VoiceData) {
+  if (bEnableVoiceLayer && VoiceData && PresentsEvents() &&
+      IsLayerSignificant(EPRFoleyLayerMask::Voice)) {
     if (AActor *Owner = GetOwner()) {
       const FVector OwnerLocation = Owner->GetActorLocation();
       float Vol = PlaySoundWithSettings(VoiceData->JumpEffort, OwnerLocation,
@@ -517,18 +695,22 @@ void UPRFoleyComponent::HandleJump() {
   FHitResult Hit;
   FVector StartLocation = FVector::ZeroVector;
   FVector EndLocation = FVector::ZeroVector;
-  if (TraceFootstep(SocketToUse, Hit, StartLocation, EndLocation)) {
-    EPhysicalSurface Surface = GetSurfaceFromHit(Hit);
-    LastHitNormal = Hit.ImpactNormal;
-    PlaySurfaceJump(Surface, Hit.ImpactPoint);
 
-    // VFX for jump
-    PlaySurfaceVFX(Surface, Hit.ImpactPoint, Hit.ImpactNormal,
-                   EPRFoleyEventType::Jump);
+  if (ShouldUseAsyncTrace()) {
+    if (!ComputeFootstepTrace(SocketToUse, StartLocation, EndLocation)) {
+      return;
+    }
+    if (FindGroundWithoutTrace(SocketToUse, StartLocation, EndLocation, Hit,
+                               true)) {
+      HandleJumpSurface(Hit);
+    } else {
+      RequestAsyncTrace(StartLocation, EndLocation, EPRFoleyEventType::Jump);
+    }
+    return;
+  }
 
-    // Network broadcast
-    BroadcastNetworkFoleyEvent(Surface, Hit.ImpactPoint, Hit.ImpactNormal,
-                               EPRFoleyEventType::Jump, false);
+  if (TraceFootstep(SocketToUse, Hit, StartLocation, EndLocation, true)) {
+    HandleJumpSurface(Hit);
   } else if (bDebugTraces) {
     UE_LOG(LogPRAudio, Warning,
            TEXT("[PRFoley] Jump Trace MISSED from %s to %s"),
@@ -536,21 +718,41 @@ void UPRFoleyComponent::HandleJump() {
   }
 }
 
+void UPRFoleyComponent::HandleJumpSurface(const FHitResult &Hit) {
+  EPhysicalSurface Surface = GetSurfaceFromHit(Hit);
+  if (!PresentsEvents()) {
+    ReportFoleyNoise(Surface, Hit.ImpactPoint, EPRFoleyEventType::Jump, false);
+    return;
+  }
+  const EPhysicalSurface PlayedSurface = StreamSurface(Surface);
+  LastHitNormal = Hit.ImpactNormal;
+  PlaySurfaceJump(PlayedSurface, Hit.ImpactPoint);
+
+  // VFX for jump
+  PlaySurfaceVFX(PlayedSurface, Hit.ImpactPoint, Hit.ImpactNormal,
+                 EPRFoleyEventType::Jump);
+
+  // Network broadcast
+  BroadcastNetworkFoleyEvent(Surface, Hit.ImpactPoint, Hit.ImpactNormal,
+                             EPRFoleyEventType::Jump, false);
+  ReportFoleyNoise(Surface, Hit.ImpactPoint, EPRFoleyEventType::Jump, false);
+}
+
 // ============================================================================
 // Core: HandleLand
 // ============================================================================
 
-void UPRFoleyComponent::HandleLand(const FHitResult &Hit) {
-  if (!IsInLODRadius()) {
+void UPRFoleyComponent::HandleLand(const FHitResult &Hit, float FallSpeed) {
+  if (!ShouldDetectEvents()) {
     return;
   }
 
   AActor *Owner = GetOwner();
-  const float FallVelocity = Owner ? FMath::Abs(Owner->GetVelocity().Z) : 0.0f;
   const bool bHeavyLand =
-      FootstepData && FallVelocity > FootstepData->HeavyLandThresholdVelocity;
+      FootstepData && FallSpeed > FootstepData->HeavyLandThresholdVelocity;
 
-  if (bEnableVoiceLayer && VoiceData) {
+  if (bEnableVoiceLayer && VoiceData && PresentsEvents() &&
+      IsLayerSignificant(EPRFoleyLayerMask::Voice)) {
     if (Owner) {
       const FVector OwnerLocation = Owner->GetActorLocation();
       USoundBase *ExhaleSound = bHeavyLand && VoiceData->HeavyLandExhale
@@ -569,29 +771,38 @@ void UPRFoleyComponent::HandleLand(const FHitResult &Hit) {
   }
 
   const EPhysicalSurface Surface = GetSurfaceFromHit(Hit);
+  if (!PresentsEvents()) {
+    ReportFoleyNoise(Surface, Hit.ImpactPoint, EPRFoleyEventType::Land,
+                     bHeavyLand);
+    return;
+  }
+  const EPhysicalSurface PlayedSurface = StreamSurface(Surface);
   const FVector HitNormal =
       Hit.ImpactNormal.IsNearlyZero() ? FVector::UpVector : Hit.ImpactNormal;
   LastHitNormal = HitNormal;
 
-  PlaySurfaceLand(Surface, Hit.ImpactPoint);
+  PlaySurfaceLand(PlayedSurface, Hit.ImpactPoint);
 
   // VFX for land
-  PlaySurfaceVFX(Surface, Hit.ImpactPoint, HitNormal, EPRFoleyEventType::Land);
+  PlaySurfaceVFX(PlayedSurface, Hit.ImpactPoint, HitNormal,
+                 EPRFoleyEventType::Land);
 
   // Network broadcast
   BroadcastNetworkFoleyEvent(Surface, Hit.ImpactPoint, HitNormal,
                              EPRFoleyEventType::Land, bHeavyLand);
+  ReportFoleyNoise(Surface, Hit.ImpactPoint, EPRFoleyEventType::Land,
+                   bHeavyLand);
 
   if (FootstepData->bPlayFootstepAfterLandImpact) {
     const float Delay = FootstepData->FootstepDelayAfterLand;
     const FVector SurfaceLocation = Hit.ImpactPoint;
     if (Delay <= 0.0f) {
-      PlaySurfaceFootstep(Surface, SurfaceLocation);
+      PlaySurfaceFootstep(PlayedSurface, SurfaceLocation);
     } else if (UWorld *World = GetWorld()) {
       World->GetTimerManager().ClearTimer(LandFootstepTimerHandle);
       FTimerDelegate Delegate;
-      Delegate.BindWeakLambda(this, [this, Surface, SurfaceLocation]() {
-        PlaySurfaceFootstep(Surface, SurfaceLocation);
+      Delegate.BindWeakLambda(this, [this, PlayedSurface, SurfaceLocation]() {
+        PlaySurfaceFootstep(PlayedSurface, SurfaceLocation);
       });
       World->GetTimerManager().SetTimer(LandFootstepTimerHandle, Delegate,
                                         Delay, false);
@@ -604,36 +815,46 @@ void UPRFoleyComponent::HandleLand(const FHitResult &Hit) {
 // ============================================================================
 
 void UPRFoleyComponent::HandleFootstep(const FHitResult &Hit) {
-  if (!IsInLODRadius()) {
+  if (!ShouldDetectEvents()) {
     return;
   }
   if (Hit.bBlockingHit) {
     EPhysicalSurface Surface = GetSurfaceFromHit(Hit);
     LastDetectedSurface = Surface;
+    if (!PresentsEvents()) {
+      ReportFoleyNoise(Surface, Hit.ImpactPoint, EPRFoleyEventType::Footstep,
+                       false);
+      return;
+    }
+    const EPhysicalSurface PlayedSurface = StreamSurface(Surface);
     const FVector HitNormal =
         Hit.ImpactNormal.IsNearlyZero() ? FVector::UpVector : Hit.ImpactNormal;
 
-    PlayFootstepSound(Surface, Hit.ImpactPoint);
+    PlayFootstepSound(PlayedSurface, Hit.ImpactPoint);
 
     // Landscape blending: play secondary surface sound at reduced volume
-    if (FootstepData && FootstepData->bEnableLandscapeBlending) {
+    if (FootstepData && FootstepData->bEnableLandscapeBlending &&
+        !IsServerStripped()) {
       EPhysicalSurface SecondarySurface;
       float SecondaryWeight;
-      if (GetLandscapeBlendSurface(Hit, SecondarySurface, SecondaryWeight)) {
+      if (GetLandscapeBlendSurface(Hit, SecondarySurface, SecondaryWeight) &&
+          StreamSurface(SecondarySurface) == SecondarySurface) {
         PlaySurfaceFootstep(SecondarySurface, Hit.ImpactPoint);
       }
     }
 
     // VFX for footstep
-    PlaySurfaceVFX(Surface, Hit.ImpactPoint, HitNormal,
+    PlaySurfaceVFX(PlayedSurface, Hit.ImpactPoint, HitNormal,
                    EPRFoleyEventType::Footstep);
 
     // Decal for footstep
-    SpawnFootprintDecal(Surface, Hit.ImpactPoint, HitNormal);
+    SpawnFootprintDecal(PlayedSurface, Hit.ImpactPoint, HitNormal);
 
     // Network broadcast
     BroadcastNetworkFoleyEvent(Surface, Hit.ImpactPoint, HitNormal,
                                EPRFoleyEventType::Footstep, false);
+    ReportFoleyNoise(Surface, Hit.ImpactPoint, EPRFoleyEventType::Footstep,
+                     false);
   }
 }
 
@@ -643,9 +864,11 @@ void UPRFoleyComponent::HandleFootstep(const FHitResult &Hit) {
 
 bool UPRFoleyComponent::PerformTrace(const FVector &Start, const FVector &End,
                                      FHitResult &OutHit) {
-  FCollisionQueryParams Params;
-  Params.AddIgnoredActor(GetOwner());
-  Params.bReturnPhysicalMaterial = true; // Crucial
+  SCOPE_CYCLE_COUNTER(STAT_PRFoley_PerformTrace);
+  TRACE_CPUPROFILER_EVENT_SCOPE(PRFoley_PerformTrace);
+  PRFOLEY_COUNT(TracesIssued, 1);
+
+  const FCollisionQueryParams &Params = FoleyQueryParams;
 
   bool bHit = false;
 
@@ -680,71 +903,97 @@ bool UPRFoleyComponent::PerformTrace(const FVector &Start, const FVector &End,
         OutHit, Start, End, FQuat::Identity, Channel,
         FCollisionShape::MakeSphere(ShapeRadius), Params);
     if (!bHit) {
+      PRFOLEY_COUNT(TracesIssued, 1);
       bHit = GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, Channel,
                                                   Params);
     }
     break;
   }
 
+  DrawTraceDebug(Start, End, bHit, OutHit);
+
+  return bHit;
+}
+
+void UPRFoleyComponent::DrawTraceDebug(const FVector &Start,
+                                       const FVector &End, bool bHit,
+                                       const FHitResult &OutHit) const {
 #if !UE_BUILD_SHIPPING
-  if (bDebugTraces) {
-    if (TraceMode == EPRTraceType::Line) {
-      DrawDebugLine(GetWorld(), Start, End, bHit ? FColor::Green : FColor::Red,
-                    false, 1.0f);
-    } else if (TraceMode == EPRTraceType::Box) {
-      DrawDebugBox(GetWorld(), Start,
-                   FootstepData ? FootstepData->BoxHalfExtent : FVector(10.f),
-                   bHit ? FColor::Green : FColor::Red, false, 1.0f);
-    } else {
-      float Radius = FootstepData ? FootstepData->SphereRadius : 10.0f;
-      DrawDebugCylinder(GetWorld(), Start, End, Radius, 8,
-                        bHit ? FColor::Green : FColor::Red, false, 1.0f);
-    }
-
-    if (bHit && OutHit.GetActor()) {
-      FString PhysMatName = OutHit.PhysMaterial.IsValid()
-                                ? OutHit.PhysMaterial->GetName()
-                                : TEXT("None");
-      EPhysicalSurface SurfType =
-          OutHit.PhysMaterial.IsValid()
-              ? (EPhysicalSurface)OutHit.PhysMaterial->SurfaceType
-              : SurfaceType_Default;
-      FString Msg = FString::Printf(
-          TEXT("Hit: %s | PhysMat: %s | SurfaceType: %d"),
-          *OutHit.GetActor()->GetName(), *PhysMatName, (int32)SurfType);
-      if (GEngine) {
-        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, Msg);
-      }
+  if (!bDebugTraces) {
+    return;
+  }
 
-      // Landscape-specific warning
-      if (!OutHit.PhysMaterial.IsValid() &&
-          OutHit.GetActor()->IsA<ALandscapeProxy>()) {
-        UE_LOG(LogPRAudio, Warning,
-               TEXT("[PRFoley] Landscape hit but NO PhysMat returned! "
-                    "Check: 1) Landscape Collision Complexity = 'Use Complex "
-                    "Collision As Simple' 2) Layer Info has Physical Material "
-                    "assigned 3) PhysMat has correct SurfaceType."));
-        if (GEngine) {
-          GEngine->AddOnScreenDebugMessage(
-              -1, 3.0f, FColor::Red,
-              TEXT("PR_Foley: Landscape has NO PhysMat! Check Collision "
-                   "Complexity & Layer Info."));
-        }
+  const EPRTraceType TraceMode =
+      FootstepData ? FootstepData->TraceType : EPRTraceType::Sphere;
+  if (TraceMode == EPRTraceType::Line) {
+    DrawDebugLine(GetWorld(), Start, End, bHit ? FColor::Green : FColor::Red,
+                  false, 1.0f);
+  } else if (TraceMode == EPRTraceType::Box) {
+    DrawDebugBox(GetWorld(), Start,
+                 FootstepData ? FootstepData->BoxHalfExtent : FVector(10.f),
+                 bHit ? FColor::Green : FColor::Red, false, 1.0f);
+  } else {
+    float Radius = FootstepData ? FootstepData->SphereRadius : 10.0f;
+    DrawDebugCylinder(GetWorld(), Start, End, Radius, 8,
+                      bHit ? FColor::Green : FColor::Red, false, 1.0f);
+  }
+
+  if (bHit && OutHit.GetActor()) {
+    FString PhysMatName = OutHit.PhysMaterial.IsValid()
+                              ? OutHit.PhysMaterial->GetName()
+                              : TEXT("None");
+    EPhysicalSurface SurfType =
+        OutHit.PhysMaterial.IsValid()
+            ? (EPhysicalSurface)OutHit.PhysMaterial->SurfaceType
+            : SurfaceType_Default;
+    FString Msg = FString::Printf(
+        TEXT("Hit: %s | PhysMat: %s | SurfaceType: %d"),
+        *OutHit.GetActor()->GetName(), *PhysMatName, (int32)SurfType);
+    if (GEngine) {
+      GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, Msg);
+    }
+
+    // Landscape-specific warning
+    if (!OutHit.PhysMaterial.IsValid() &&
+        OutHit.GetActor()->IsA<ALandscapeProxy>()) {
+      UE_LOG(LogPRAudio, Warning,
+             TEXT("[PRFoley] Landscape hit but NO PhysMat returned! "
+                  "Check: 1) Landscape Collision Complexity = 'Use Complex "
+                  "Collision As Simple' 2) Layer Info has Physical Material "
+                  "assigned 3) PhysMat has correct SurfaceType."));
+      if (GEngine) {
+        GEngine->AddOnScreenDebugMessage(
+            -1, 3.0f, FColor::Red,
+            TEXT("PR_Foley: Landscape has NO PhysMat! Check Collision "
+                 "Complexity & Layer Info."));
       }
     }
   }
 #endif
-
-  return bHit;
 }
 
 EPhysicalSurface UPRFoleyComponent::GetSurfaceFromHit(const FHitResult &Hit) {
+  FPRLandscapeSurfaceSample Sample;
+  if (SampleLandscapeSurfaces(Hit, Sample)) {
+    return Sample.PrimarySurface;
+  }
   if (Hit.PhysMaterial.IsValid()) {
     return Hit.PhysMaterial->SurfaceType;
   }
   return SurfaceType_Default;
 }
 
+EPhysicalSurface UPRFoleyComponent::StreamSurface(EPhysicalSurface Surface) {
+  UWorld *World = GetWorld();
+  UPRFoleyStreamingSubsystem *Streaming =
+      World ? World->GetSubsystem<UPRFoleyStreamingSubsystem>() : nullptr;
+  if (!Streaming || !FootstepData || IsServerStripped()) {
+    return Surface;
+  }
+  return Streaming->RequestSurface(FootstepData, Surface) ? Surface
+                                                          : SurfaceType_Default;
+}
+
 // ============================================================================
 // PlayFootstepSound (audio + voice step effort)
 // ============================================================================
@@ -769,22 +1018,45 @@ void UPRFoleyComponent::PlayFootstepSound(EPhysicalSurface SurfaceType,
 // ============================================================================
 
 bool UPRFoleyComponent::IsInLODRadius() const {
-  if (!FootstepData || FootstepData->MaxLODDistance <= 0.0f) {
-    return true;
-  }
+  return Significance != EPRFoleySignificance::Culled;
+}
 
-  if (!GetOwner()) {
+bool UPRFoleyComponent::IsLayerSignificant(EPRFoleyLayerMask Layer) const {
+  return EnumHasAllFlags(SignificantLayers, Layer);
+}
+
+EPRFoleySignificance UPRFoleyComponent::GetSignificance() const {
+  return Significance;
+}
+
+bool UPRFoleyComponent::HasServerConsumer() const {
+  if (GetOwnerRole() != ROLE_Authority) {
+    return false;
+  }
+  if (ReportsAINoise()) {
     return true;
   }
-
-  if (APlayerCameraManager *CamManager =
-          UGameplayStatics::GetPlayerCameraManager(this, 0)) {
-    float DistSq = FVector::DistSquared(CamManager->GetCameraLocation(),
-                                        GetOwner()->GetActorLocation());
-    return DistSq <= FMath::Square(FootstepData->MaxLODDistance);
+  if (!bEnableNetworkReplication) {
+    return false;
   }
 
-  return true;
+  // Remote players send their own network events
+  return UsesLocalSimulation() || !ReceivesClientEvents();
+}
+
+bool UPRFoleyComponent::ReportsAINoise() const {
+  return FootstepData && FootstepData->bReportAINoise &&
+         GetOwnerRole() == ROLE_Authority;
+}
+
+bool UPRFoleyComponent::ReceivesClientEvents() const {
+  if (!bEnableNetworkReplication || UsesLocalSimulation() ||
+      GetOwnerRole() != ROLE_Authority) {
+    return false;
+  }
+  const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+  return OwnerPawn && OwnerPawn->IsPlayerControlled() &&
+         !OwnerPawn->IsLocallyControlled();
 }
 
 // ============================================================================
@@ -792,7 +1064,101 @@ bool UPRFoleyComponent::IsInLODRadius() const {
 // ============================================================================
 
 bool UPRFoleyComponent::TraceFootstep(FName SocketName, FHitResult &OutHit,
-                                      FVector &OutStart, FVector &OutEnd) {
+                                      FVector &OutStart, FVector &OutEnd,
+                                      bool bJustLeftGround) {
+  if (!ComputeFootstepTrace(SocketName, OutStart, OutEnd)) {
+    return false;
+  }
+  return FindGroundWithoutTrace(SocketName, OutStart, OutEnd, OutHit,
+                                bJustLeftGround) ||
+         PerformTrace(OutStart, OutEnd, OutHit);
+}
+
+bool UPRFoleyComponent::FindGroundWithoutTrace(FName SocketName,
+                                               const FVector &Start,
+                                               const FVector &End,
+                                               FHitResult &OutHit,
+                                               bool bJustLeftGround) {
+  // The capsule floor is only as precise as a capsule-centered trace
+  if (!UsesSocketTrace(SocketName) &&
+      GetMovementFloorHit(OutHit, bJustLeftGround)) {
+    DrawTraceDebug(Start, End, true, OutHit);
+    return true;
+  }
+  return TraceSurfaceGrid(Start, End, OutHit);
+}
+
+bool UPRFoleyComponent::UsesSocketTrace(FName SocketName) const {
+  if (!FootstepData || !OwnerMesh) {
+    return false;
+  }
+  if (FootstepData->bUseFootSockets && SocketName != NAME_None &&
+      OwnerMesh->DoesSocketExist(SocketName)) {
+    return true;
+  }
+  return FootstepData->TraceStartRef == EPRTraceStartReference::Socket &&
+         FootstepData->ReferenceSocketName != NAME_None &&
+         OwnerMesh->DoesSocketExist(FootstepData->ReferenceSocketName);
+}
+
+bool UPRFoleyComponent::GetMovementFloorHit(FHitResult &OutHit,
+                                            bool bJustLeftGround) {
+  if (!FootstepData || !FootstepData->bUseMovementFloor) {
+    return false;
+  }
+  const ACharacter *Character = Cast<ACharacter>(GetOwner());
+  const UCharacterMovementComponent *Movement =
+      Character ? Character->GetCharacterMovement() : nullptr;
+  if (!Movement) {
+    return false;
+  }
+
+  const FFindFloorResult &Floor = Movement->CurrentFloor;
+  if (Floor.IsWalkableFloor() && IsUsableFloorHit(Floor.HitResult)) {
+    OutHit = Floor.HitResult;
+    LastFloorHit = OutHit;
+    return true;
+  }
+
+  // Leaving the ground clears CurrentFloor before MovementModeChanged fires
+  const FVector Location = Character->GetActorLocation();
+  if (!bJustLeftGround || !LastFloorHit.bBlockingHit ||
+      FVector::DistSquared2D(LastFloorHit.ImpactPoint, Location) >
+          FMath::Square(FootstepData->FootIntervalDistance)) {
+    return false;
+  }
+  OutHit = LastFloorHit;
+  OutHit.ImpactPoint.X = Location.X;
+  OutHit.ImpactPoint.Y = Location.Y;
+  return true;
+}
+
+void UPRFoleyComponent::RequestMovementMaterials() {
+  const ACharacter *Character = Cast<ACharacter>(GetOwner());
+  if (FootstepData && FootstepData->bUseMovementFloor && Character &&
+      Character->GetCapsuleComponent()) {
+    Character->GetCapsuleComponent()->bReturnMaterialOnMove = true;
+  }
+}
+
+bool UPRFoleyComponent::TraceSurfaceGrid(const FVector &Start,
+                                         const FVector &End,
+                                         FHitResult &OutHit) {
+  UWorld *World = GetWorld();
+  UPRFoleySurfaceGridSubsystem *SurfaceGrid =
+      World ? World->GetSubsystem<UPRFoleySurfaceGridSubsystem>() : nullptr;
+  if (!SurfaceGrid || !SurfaceGrid->HasGrid() ||
+      !SurfaceGrid->TraceGrid(Start, End, OutHit)) {
+    return false;
+  }
+  PRFOLEY_COUNT(GridHits, 1);
+  DrawTraceDebug(Start, End, true, OutHit);
+  return true;
+}
+
+bool UPRFoleyComponent::ComputeFootstepTrace(FName SocketName,
+                                             FVector &OutStart,
+                                             FVector &OutEnd) const {
   if (!FootstepData || !GetOwner()) {
     return false;
   }
@@ -839,8 +1205,94 @@ bool UPRFoleyComponent::TraceFootstep(FName SocketName, FHitResult &OutHit,
     }
   }
 
+  OutStart += StepLocationOffset;
   OutEnd = OutStart - FVector(0, 0, FootstepData->TraceLength);
-  return PerformTrace(OutStart, OutEnd, OutHit);
+  return true;
+}
+
+// ============================================================================
+// Async Trace
+// ============================================================================
+
+bool UPRFoleyComponent::ShouldUseAsyncTrace() const {
+  if (!FootstepData || !FootstepData->bUseAsyncTraces) {
+    return false;
+  }
+  const UWorld *World = GetWorld();
+  return World && World->GetSubsystem<UPRFoleyTraceSubsystem>();
+}
+
+bool UPRFoleyComponent::RequestAsyncTrace(const FVector &Start,
+                                          const FVector &End,
+                                          EPRFoleyEventType EventType,
+                                          float FallSpeed) {
+  UWorld *World = GetWorld();
+  UPRFoleyTraceSubsystem *TraceSubsystem =
+      World ? World->GetSubsystem<UPRFoleyTraceSubsystem>() : nullptr;
+  if (!TraceSubsystem || !FootstepData) {
+    return false;
+  }
+
+  FPRFoleyTraceRequest Request;
+  Request.Component = this;
+  Request.Start = Start;
+  Request.End = End;
+  Request.Channel = FootstepData->TraceChannel.GetValue();
+  Request.EventType = EventType;
+  Request.FallSpeed = FallSpeed;
+  Request.StartDelay = StepStartDelay;
+
+  switch (FootstepData->TraceType) {
+  case EPRTraceType::Line:
+    Request.Shape = FCollisionShape::LineShape;
+    break;
+  case EPRTraceType::Sphere:
+    Request.Shape = FCollisionShape::MakeSphere(FootstepData->SphereRadius);
+    break;
+  case EPRTraceType::Box:
+    Request.Shape = FCollisionShape::MakeBox(FootstepData->BoxHalfExtent);
+    break;
+  case EPRTraceType::Multi:
+    Request.Shape = FCollisionShape::MakeSphere(FootstepData->SphereRadius);
+    Request.bLineFallback = true;
+    break;
+  }
+
+  return TraceSubsystem->RequestTrace(Request);
+}
+
+void UPRFoleyComponent::OnAsyncTraceCompleted(EPRFoleyEventType EventType,
+                                              bool bHit, const FHitResult &Hit,
+                                              float FallSpeed,
+                                              float StartDelay) {
+  TGuardValue<float> DelayGuard(StepStartDelay, StartDelay);
+
+  switch (EventType) {
+  case EPRFoleyEventType::Footstep:
+    if (bHit) {
+      LastHitNormal = Hit.ImpactNormal;
+      HandleFootstep(Hit);
+    }
+    break;
+
+  case EPRFoleyEventType::Jump:
+    if (bHit) {
+      HandleJumpSurface(Hit);
+    }
+    break;
+
+  case EPRFoleyEventType::Land:
+    if (bHit) {
+      LastHitNormal = Hit.ImpactNormal;
+    }
+    HandleLand(bHit ? Hit : FHitResult(), FallSpeed);
+    break;
+  }
+
+  if (!bHit && bDebugTraces) {
+    UE_LOG(LogPRAudio, Warning, TEXT("[PRFoley] Async %s trace MISSED"),
+           *UEnum::GetValueAsString(EventType));
+  }
 }
 
 // ============================================================================
@@ -850,25 +1302,26 @@ bool UPRFoleyComponent::TraceFootstep(FName SocketName, FHitResult &OutHit,
 float UPRFoleyComponent::PlaySoundWithSettings(
     USoundBase *SoundToPlay, const FVector &Location,
     const FPRFoleyAudioSettings &AudioSettings) {
+  SCOPE_CYCLE_COUNTER(STAT_PRFoley_PlaySound);
+  TRACE_CPUPROFILER_EVENT_SCOPE(PRFoley_PlaySoundWithSettings);
+
   if (!SoundToPlay) {
     return 0.0f;
   }
+  PRFOLEY_COUNT(SoundsSpawned, 1);
 
   float Volume = FMath::RandRange(AudioSettings.VolumeRange.X,
                                   AudioSettings.VolumeRange.Y);
   float Pitch =
       FMath::RandRange(AudioSettings.PitchRange.X, AudioSettings.PitchRange.Y);
 
-  if (AudioSettings.EffectsChain || AudioSettings.ConcurrencySettings) {
-    if (UAudioComponent *SpawnedAudio = UGameplayStatics::SpawnSoundAtLocation(
-            this, SoundToPlay, Location, FRotator::ZeroRotator, Volume, Pitch,
-            0.0f, AudioSettings.AttenuationSettings,
-            AudioSettings.ConcurrencySettings, false)) {
-      if (AudioSettings.EffectsChain) {
-        SpawnedAudio->SetSourceEffectChain(AudioSettings.EffectsChain);
-      }
-      SpawnedAudio->Play();
-    }
+  UPRFoleyAudioPoolSubsystem *AudioPool =
+      GetWorld() ? GetWorld()->GetSubsystem<UPRFoleyAudioPoolSubsystem>()
+                 : nullptr;
+
+  if ((AudioSettings.EffectsChain || AudioSettings.ConcurrencySettings) &&
+      AudioPool) {
+    AudioPool->PlaySound(SoundToPlay, Location, Volume, Pitch, AudioSettings);
   } else {
     UGameplayStatics::PlaySoundAtLocation(
         this, SoundToPlay, Location, Volume, Pitch, 0.0f,
@@ -878,25 +1331,95 @@ float UPRFoleyComponent::PlaySoundWithSettings(
   return Volume;
 }
 
-const FPRSurfaceFoleyConfig *UPRFoleyComponent::ResolveSurfaceConfig(
-    const TArray<FPRSurfaceFoleyConfig> &ConfigArray,
-    EPhysicalSurface SurfaceType, bool &bOutDefault) const {
-  bOutDefault = false;
+float UPRFoleyComponent::PlaySurfaceSound(
+    USoundBase *SoundToPlay, const FVector &Location,
+    const FPRFoleyAudioSettings &AudioSettings, EPhysicalSurface SurfaceType,
+    EPRFoleyEventType EventType) {
+  if (!SoundToPlay) {
+    return 0.0f;
+  }
 
-  for (const FPRSurfaceFoleyConfig &Entry : ConfigArray) {
-    if (Entry.Surface == SurfaceType) {
-      return &Entry;
+  // Below AudioOnly the voice is released; steps go out as one-shots
+  if (FootstepData && FootstepData->FootstepMetaSound &&
+      IsLayerSignificant(EPRFoleyLayerMask::Voice)) {
+    if (USoundWave *Wave = Cast<USoundWave>(SoundToPlay)) {
+      const float Volume = FMath::RandRange(AudioSettings.VolumeRange.X,
+                                            AudioSettings.VolumeRange.Y);
+      const float Pitch = FMath::RandRange(AudioSettings.PitchRange.X,
+                                           AudioSettings.PitchRange.Y);
+      if (TriggerFootstepVoice(Wave, Volume, Pitch, SurfaceType, EventType)) {
+        return Volume;
+      }
     }
   }
 
-  for (const FPRSurfaceFoleyConfig &Entry : ConfigArray) {
-    if (Entry.Surface == EPhysicalSurface::SurfaceType_Default) {
-      bOutDefault = true;
-      return &Entry;
+  return PlaySoundWithSettings(SoundToPlay, Location, AudioSettings);
+}
+
+bool UPRFoleyComponent::TriggerFootstepVoice(USoundWave *Wave, float Volume,
+                                             float Pitch,
+                                             EPhysicalSurface SurfaceType,
+                                             EPRFoleyEventType EventType) {
+  // One event per frame; extra ones (jump + takeoff step, several Distance
+  // strides) fall back to the one-shot path instead of being overwritten.
+  if (FootstepVoiceFrame == GFrameCounter) {
+    return false;
+  }
+
+  if (!FootstepVoiceComp) {
+    USceneComponent *AttachComp =
+        OwnerMesh ? OwnerMesh.Get()
+                  : (GetOwner() ? GetOwner()->GetRootComponent() : nullptr);
+    if (!AttachComp) {
+      return false;
+    }
+
+    const FPRFoleyAudioSettings &AudioSettings = FootstepData->SurfaceAudio;
+    FootstepVoiceComp = UGameplayStatics::SpawnSoundAttached(
+        FootstepData->FootstepMetaSound, AttachComp, NAME_None,
+        FVector::ZeroVector, FRotator::ZeroRotator,
+        EAttachLocation::KeepRelativeOffset, true, 1.0f, 1.0f, 0.0f,
+        AudioSettings.AttenuationSettings, AudioSettings.ConcurrencySettings,
+        false);
+    if (!FootstepVoiceComp) {
+      UE_LOG(LogPRAudio, Warning,
+             TEXT("[PRFoley] Failed to spawn footstep MetaSound voice: %s"),
+             *GetNameSafe(FootstepData->FootstepMetaSound));
+      return false;
+    }
+    if (AudioSettings.EffectsChain) {
+      FootstepVoiceComp->SetSourceEffectChain(AudioSettings.EffectsChain);
     }
   }
 
-  return nullptr;
+  // Parameters are applied in order, so the trigger goes last.
+  TArray<FAudioParameter> Params;
+  Params.Reserve(7);
+  Params.Emplace(FootstepData->StepWaveParamName, Wave);
+  Params.Emplace(FootstepData->StepVolumeParamName, Volume);
+  Params.Emplace(FootstepData->StepPitchParamName, Pitch);
+  Params.Emplace(FootstepData->StepSurfaceParamName,
+                 static_cast<int32>(SurfaceType));
+  Params.Emplace(FootstepData->StepEventTypeParamName,
+                 static_cast<int32>(EventType));
+  Params.Emplace(FootstepData->StepDelayParamName, StepStartDelay);
+  FAudioParameter &Trigger =
+      Params.Emplace_GetRef(FootstepData->StepTriggerParamName, true);
+  Trigger.ParamType = EAudioParameterType::Trigger;
+
+  if (!FootstepVoiceComp->IsPlaying()) {
+    FootstepVoiceComp->Play();
+  }
+  FootstepVoiceComp->SetParameters(MoveTemp(Params));
+  FootstepVoiceFrame = GFrameCounter;
+  return true;
+}
+
+void UPRFoleyComponent::StopFootstepVoice() {
+  if (FootstepVoiceComp) {
+    FootstepVoiceComp->Stop();
+    FootstepVoiceComp = nullptr;
+  }
 }
 
 USoundBase *
@@ -920,7 +1443,8 @@ UPRFoleyComponent::SelectSoundFromSet(const FPRSurfaceSoundSet &SoundSet,
   }
 
   LastIndex = NewIndex;
-  return SoundSet.Sounds[NewIndex];
+  // Null while the surface is still streaming in
+  return SoundSet.Sounds[NewIndex].Get();
 }
 
 // ============================================================================
@@ -973,29 +1497,23 @@ UPRFoleyComponent::ResolveBreathingLoopSound(EPRVelocityTier Tier) const {
 // Breathing
 // ============================================================================
 
-void UPRFoleyComponent::UpdateBreathingLoop() {
+void UPRFoleyComponent::UpdateBreathingLoop(float DeltaTime) {
   if (!GetOwner()) {
     return;
   }
 
   if (!bEnableVoiceLayer || !VoiceData) {
-    if (BreathingComp_A)
-      BreathingComp_A->FadeOut(0.5f, 0.0f);
-    if (BreathingComp_B)
-      BreathingComp_B->FadeOut(0.5f, 0.0f);
+    FadeOutBreathing(0.5f);
     return;
   }
 
   if (VoiceData->BreathingMetaSound) {
-    UpdateBreathingMetaSound();
+    UpdateBreathingMetaSound(DeltaTime);
     return;
   }
 
   if (VoiceData->BreathingLoops.Num() == 0) {
-    if (BreathingComp_A)
-      BreathingComp_A->FadeOut(0.5f, 0.0f);
-    if (BreathingComp_B)
-      BreathingComp_B->FadeOut(0.5f, 0.0f);
+    FadeOutBreathing(0.5f);
     return;
   }
 
@@ -1006,32 +1524,28 @@ void UPRFoleyComponent::UpdateBreathingLoop() {
     OnBreathingTierChanged.Broadcast(CurrentBreathingTier);
   }
 
-  USoundBase *TargetSound = ResolveBreathingLoopSound(NewTier);
-  if (!TargetSound) {
-    if (BreathingComp_A)
-      BreathingComp_A->FadeOut(VoiceData->BreathingFadeTime, 0.0f);
-    if (BreathingComp_B)
-      BreathingComp_B->FadeOut(VoiceData->BreathingFadeTime, 0.0f);
+  if (bBreathingVirtual) {
     return;
   }
 
-  UAudioComponent *ActiveComp =
-      bBreathingPingPong ? BreathingComp_B : BreathingComp_A;
-
-  if (ActiveComp && ActiveComp->IsPlaying() &&
-      ActiveComp->GetSound() == TargetSound) {
+  // Every tier loop is already running (paused): a tier change is a gain
+  // crossfade, never a decoder restart
+  const int32 TierIndex = static_cast<int32>(NewTier);
+  UAudioComponent *TierComp = BreathingLoopComps.IsValidIndex(TierIndex)
+                                  ? BreathingLoopComps[TierIndex].Get()
+                                  : nullptr;
+  if (!TierComp) {
+    FadeOutBreathing(VoiceData->BreathingFadeTime);
+    return;
+  }
+  if (AudibleBreathingLoop == TierIndex) {
     return;
   }
 
-  bBreathingPingPong = !bBreathingPingPong;
-
-  TObjectPtr<UAudioComponent> &NewComp =
-      bBreathingPingPong ? BreathingComp_B : BreathingComp_A;
-  TObjectPtr<UAudioComponent> &OldComp =
-      bBreathingPingPong ? BreathingComp_A : BreathingComp_B;
-
-  if (OldComp && OldComp->IsPlaying()) {
-    OldComp->FadeOut(VoiceData->BreathingFadeTime, 0.0f);
+  const float FadeTime = VoiceData->BreathingFadeTime;
+  if (BreathingLoopComps.IsValidIndex(AudibleBreathingLoop) &&
+      BreathingLoopComps[AudibleBreathingLoop]) {
+    BreathingLoopComps[AudibleBreathingLoop]->AdjustVolume(FadeTime, 0.0f);
   }
 
   const float Volume = FMath::RandRange(VoiceData->VoiceAudio.VolumeRange.X,
@@ -1039,35 +1553,130 @@ void UPRFoleyComponent::UpdateBreathingLoop() {
   const float Pitch = FMath::RandRange(VoiceData->VoiceAudio.PitchRange.X,
                                        VoiceData->VoiceAudio.PitchRange.Y);
 
+  TierComp->SetPitchMultiplier(Pitch);
+  TierComp->SetPaused(false);
+  if (!TierComp->IsPlaying()) {
+    // Stopped behind our back (concurrency, device change): restart silent
+    TierComp->FadeIn(0.0f, 0.0f);
+  }
+  TierComp->AdjustVolume(FadeTime, Volume);
+  AudibleBreathingLoop = TierIndex;
+
+  SchedulePauseSilentBreathingLoops(FadeTime);
+}
+
+void UPRFoleyComponent::PrimeBreathingLoops() {
+  ReleaseBreathingLoops();
+
+  if (!VoiceData || VoiceData->BreathingMetaSound || !bEnableVoiceLayer ||
+      IsServerStripped()) {
+    return;
+  }
+
   USceneComponent *AttachComp =
       OwnerMesh ? OwnerMesh.Get()
                 : (GetOwner() ? GetOwner()->GetRootComponent() : nullptr);
+  if (!AttachComp) {
+    return;
+  }
 
-  if (!NewComp) {
-    if (AttachComp) {
-      NewComp = UGameplayStatics::SpawnSoundAttached(
-          TargetSound, AttachComp, NAME_None, FVector::ZeroVector,
-          FRotator::ZeroRotator, EAttachLocation::KeepRelativeOffset, false,
-          Volume, Pitch, 0.0f, VoiceData->VoiceAudio.AttenuationSettings,
-          nullptr, false);
+  BreathingLoopComps.SetNum(static_cast<int32>(EPRVelocityTier::Sprint) + 1);
+  for (int32 TierIndex = 0; TierIndex < BreathingLoopComps.Num();
+       ++TierIndex) {
+    USoundBase *Sound =
+        ResolveBreathingLoopSound(static_cast<EPRVelocityTier>(TierIndex));
+    if (!Sound) {
+      continue;
     }
-  } else {
-    NewComp->Stop();
-    NewComp->SetSound(TargetSound);
-    NewComp->SetVolumeMultiplier(Volume);
-    NewComp->SetPitchMultiplier(Pitch);
-    NewComp->Play();
-  }
 
-  if (NewComp) {
+    // A silent loop with virtualization disabled is stopped by the mixer.
+    // PlayWhenSilent keeps it decoding, so unpausing resumes in phase;
+    // Restart would bring back the decoder start priming is meant to avoid.
+    if (Sound->VirtualizationMode == EVirtualizationMode::Disabled) {
+      UE_LOG(LogPRAudio, Log,
+             TEXT("[PRFoley] Breathing loop %s set to PlayWhenSilent"),
+             *Sound->GetName());
+      Sound->VirtualizationMode = EVirtualizationMode::PlayWhenSilent;
+    }
+
+    // Started at zero volume then paused: the source and its decoder stay
+    // alive, and nothing is heard before the first fade in
+    UAudioComponent *Comp =
+        NewObject<UAudioComponent>(GetOwner(), NAME_None, RF_Transient);
+    Comp->bAutoActivate = false;
+    Comp->bAutoDestroy = false;
+    Comp->bStopWhenOwnerDestroyed = true;
+    Comp->SetSound(Sound);
+    Comp->AttenuationSettings = VoiceData->VoiceAudio.AttenuationSettings;
+    Comp->SetupAttachment(AttachComp);
+    Comp->RegisterComponent();
     if (VoiceData->VoiceAudio.EffectsChain) {
-      NewComp->SetSourceEffectChain(VoiceData->VoiceAudio.EffectsChain);
+      Comp->SetSourceEffectChain(VoiceData->VoiceAudio.EffectsChain);
+    }
+    Comp->FadeIn(0.0f, 0.0f);
+    Comp->SetPaused(true);
+    BreathingLoopComps[TierIndex] = Comp;
+  }
+}
+
+void UPRFoleyComponent::ReleaseBreathingLoops(float FadeTime) {
+  if (UWorld *World = GetWorld()) {
+    World->GetTimerManager().ClearTimer(BreathingPauseTimerHandle);
+  }
+
+  for (int32 TierIndex = 0; TierIndex < BreathingLoopComps.Num();
+       ++TierIndex) {
+    UAudioComponent *Comp = BreathingLoopComps[TierIndex];
+    if (!Comp) {
+      continue;
+    }
+    if (Comp->bIsPaused) {
+      Comp->DestroyComponent();
+    } else {
+      // Audible, or fading out (FadeOutBreathing just before a swap)
+      Comp->bAutoDestroy = true;
+      Comp->FadeOut(FadeTime, 0.0f);
     }
-    NewComp->FadeIn(VoiceData->BreathingFadeTime, Volume);
   }
+  BreathingLoopComps.Reset();
+  AudibleBreathingLoop = INDEX_NONE;
 }
 
-void UPRFoleyComponent::UpdateBreathingMetaSound() {
+void UPRFoleyComponent::FadeOutBreathing(float FadeTime) {
+  if (BreathingComp_A && BreathingComp_A->IsPlaying()) {
+    BreathingComp_A->FadeOut(FadeTime, 0.0f);
+  }
+
+  if (BreathingLoopComps.IsValidIndex(AudibleBreathingLoop) &&
+      BreathingLoopComps[AudibleBreathingLoop]) {
+    BreathingLoopComps[AudibleBreathingLoop]->AdjustVolume(FadeTime, 0.0f);
+    AudibleBreathingLoop = INDEX_NONE;
+    SchedulePauseSilentBreathingLoops(FadeTime);
+  }
+}
+
+void UPRFoleyComponent::SchedulePauseSilentBreathingLoops(float FadeTime) {
+  if (UWorld *World = GetWorld()) {
+    World->GetTimerManager().SetTimer(
+        BreathingPauseTimerHandle, this,
+        &UPRFoleyComponent::PauseSilentBreathingLoops,
+        FMath::Max(FadeTime, 0.01f), false);
+  }
+}
+
+void UPRFoleyComponent::PauseSilentBreathingLoops() {
+  for (int32 TierIndex = 0; TierIndex < BreathingLoopComps.Num();
+       ++TierIndex) {
+    if (TierIndex != AudibleBreathingLoop && BreathingLoopComps[TierIndex]) {
+      BreathingLoopComps[TierIndex]->SetPaused(true);
+    }
+  }
+}
+
+void UPRFoleyComponent::UpdateBreathingMetaSound(float DeltaTime) {
+  SCOPE_CYCLE_COUNTER(STAT_PRFoley_UpdateBreathingMetaSound);
+  TRACE_CPUPROFILER_EVENT_SCOPE(PRFoley_UpdateBreathingMetaSound);
+
   if (!GetOwner()) {
     UE_LOG(LogPRAudio, Verbose,
            TEXT("[PRFoley] UpdateBreathingMetaSound failed: No Owner"));
@@ -1091,7 +1700,6 @@ void UPRFoleyComponent::UpdateBreathingMetaSound() {
   const float MaxSpeed = FMath::Max(VoiceData->SprintSpeedThreshold, 1.0f);
   const float WalkThreshold = VoiceData->WalkSpeedThreshold;
   const float SprintThreshold = VoiceData->SprintSpeedThreshold;
-  const float DeltaTime = GetWorld() ? GetWorld()->GetDeltaSeconds() : 0.016f;
 
   // ---- 1. Intensity (master, 0-1) ----
   float Intensity;
@@ -1101,7 +1709,7 @@ void UPRFoleyComponent::UpdateBreathingMetaSound() {
     Intensity = FMath::GetMappedRangeValueClamped(FVector2D(0.f, MaxSpeed),
                                                   FVector2D(0.f, 1.f), Speed);
   }
-  CachedBreathingIntensity = Intensity;
+  BreathingIntensity = Intensity;
 
   // ---- 2. BreathRate (0-1, maps to ~0.3-2.5 Hz in MetaSound) ----
   float BreathRate = FMath::GetMappedRangeValueClamped(
@@ -1153,6 +1761,17 @@ void UPRFoleyComponent::UpdateBreathingMetaSound() {
 
   PreviousVelocityTier = CurrentTier;
 
+  // ---- Tier changed event ----
+  if (CurrentTier != CurrentBreathingTier) {
+    CurrentBreathingTier = CurrentTier;
+    OnBreathingTierChanged.Broadcast(CurrentBreathingTier);
+  }
+
+  // Virtual: state above is simulated, nothing is played or sent
+  if (bBreathingVirtual) {
+    return;
+  }
+
   // ---- Spawn MetaSound component if needed ----
   if (!BreathingComp_A || !BreathingComp_A->IsValidLowLevel()) {
     USceneComponent *AttachComp =
@@ -1178,81 +1797,193 @@ void UPRFoleyComponent::UpdateBreathingMetaSound() {
           TEXT("[PRFoley] Failed to spawn BreathingComp_A with MetaSound: %s"),
           *GetNameSafe(VoiceData->BreathingMetaSound));
     }
+  } else if (!BreathingComp_A->IsPlaying()) {
+    // Faded out while the voice layer was not significant
+    BreathingComp_A->FadeIn(VoiceData->BreathingFadeTime);
   }
 
-  // ---- Send parameters (throttled) ----
+  // ---- Send parameters (one batch, changed targets only) ----
   if (BreathingComp_A && BreathingComp_A->IsPlaying()) {
-    const float Threshold = 0.01f;
-
-    // Intensity (always sent)
-    if (FMath::Abs(FinalIntensity - CachedBreathingIntensity) > Threshold) {
-      BreathingComp_A->SetFloatParameter(VoiceData->IntensityParamName,
-                                         FinalIntensity);
-      CachedBreathingIntensity = FinalIntensity;
-    }
-
-    // BreathRate (optional param)
-    if (VoiceData->BreathRateParamName != NAME_None) {
-      if (FMath::Abs(FinalBreathRate - CachedBreathRate) > Threshold) {
-        BreathingComp_A->SetFloatParameter(VoiceData->BreathRateParamName,
-                                           FinalBreathRate);
-        CachedBreathRate = FinalBreathRate;
+    const UPRFoleySettings *Settings = GetDefault<UPRFoleySettings>();
+    const float Threshold = Settings->BreathingParamThreshold;
+
+    TArray<FAudioParameter> Params;
+    const auto AddIfDirty = [&Params, Threshold](FName Name, float Target,
+                                                 float &Sent) {
+      // Endpoints always land exactly, however small the step
+      const bool bDirty = FMath::Abs(Target - Sent) > Threshold ||
+                          ((Target <= 0.0f || Target >= 1.0f) &&
+                           Target != Sent);
+      if (Name != NAME_None && bDirty) {
+        Params.Emplace(Name, Target);
+        Sent = Target;
       }
-    }
-
-    // EffortLevel (optional param)
-    if (VoiceData->EffortLevelParamName != NAME_None) {
-      if (FMath::Abs(EffortLevel - CachedEffortLevel) > Threshold) {
-        BreathingComp_A->SetFloatParameter(VoiceData->EffortLevelParamName,
-                                           EffortLevel);
-        CachedEffortLevel = EffortLevel;
+    };
+    AddIfDirty(VoiceData->IntensityParamName, FinalIntensity,
+               CachedBreathingIntensity);
+    AddIfDirty(VoiceData->BreathRateParamName, FinalBreathRate,
+               CachedBreathRate);
+    AddIfDirty(VoiceData->EffortLevelParamName, EffortLevel,
+               CachedEffortLevel);
+    AddIfDirty(VoiceData->RecoveryPhaseParamName, RecoveryPhaseValue,
+               CachedRecoveryPhase);
+
+    if (Params.Num() > 0) {
+      // The graph glides to the new targets until the next scheduled update
+      if (Settings->BreathingRampParamName != NAME_None) {
+        const float RampTime =
+            FMath::Max(DeltaTime, GetComponentTickInterval());
+        Params.Insert(FAudioParameter(Settings->BreathingRampParamName,
+                                      RampTime),
+                      0);
       }
+      BreathingComp_A->SetParameters(MoveTemp(Params));
     }
+  }
+}
 
-    // RecoveryPhase (optional param)
-    if (VoiceData->RecoveryPhaseParamName != NAME_None) {
-      if (FMath::Abs(RecoveryPhaseValue - CachedRecoveryPhase) > Threshold) {
-        BreathingComp_A->SetFloatParameter(VoiceData->RecoveryPhaseParamName,
-                                           RecoveryPhaseValue);
-        CachedRecoveryPhase = RecoveryPhaseValue;
-      }
-    }
+void UPRFoleyComponent::UpdateBreathingSchedule(float ListenerDistanceSq) {
+  if (!bHasBreathing) {
+    return;
   }
 
-  // ---- Tier changed event ----
-  if (CurrentTier != CurrentBreathingTier) {
-    CurrentBreathingTier = CurrentTier;
-    OnBreathingTierChanged.Broadcast(CurrentBreathingTier);
+  if (!IsLayerSignificant(EPRFoleyLayerMask::Voice)) {
+    SuspendBreathing();
+    return;
+  }
+
+  // Near listeners hear the breath shape change; further out a few updates
+  // per second are enough
+  BreathingListenerDistanceSq = ListenerDistanceSq;
+  const UPRFoleySettings *Settings = GetDefault<UPRFoleySettings>();
+  const float BreathingRange = GetBreathingRange();
+  const float NearRange = BreathingRange * Settings->BreathingNearRangeFraction;
+  const bool bNear =
+      BreathingRange <= 0.0f || ListenerDistanceSq <= FMath::Square(NearRange);
+  const float Rate = bNear ? Settings->BreathingNearUpdateRate
+                           : Settings->BreathingFarUpdateRate;
+  SetComponentTickInterval(Rate > 0.0f ? 1.0f / Rate : 0.0f);
+
+  ResumeBreathing();
+}
+
+float UPRFoleyComponent::GetBreathingRange() const {
+  if (!FootstepData) {
+    return 0.0f;
+  }
+  return FootstepData->BreathingMaxDistance > 0.0f
+             ? FootstepData->BreathingMaxDistance
+             : FootstepData->MaxLODDistance;
+}
+
+float UPRFoleyComponent::GetBreathingRelevance() const {
+  const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+  if (OwnerPawn && OwnerPawn->IsLocallyControlled() &&
+      OwnerPawn->IsPlayerControlled()) {
+    return TNumericLimits<float>::Max();
+  }
+
+  const float Range = GetBreathingRange();
+  const float Distance = FMath::Sqrt(BreathingListenerDistanceSq);
+  const float Proximity =
+      Range > 0.0f ? 1.0f - FMath::Clamp(Distance / Range, 0.0f, 1.0f) : 1.0f;
+
+  // Louder breathing masks quieter one: heavy breathers rank higher
+  const float Loudness =
+      VoiceData && VoiceData->BreathingMetaSound
+          ? FMath::Max(BreathingIntensity, RecoveryPhaseValue)
+          : static_cast<float>(CurrentBreathingTier) /
+                static_cast<float>(EPRVelocityTier::Sprint);
+
+  return BreathingPriority * (0.5f + 0.5f * Loudness) * Proximity;
+}
+
+void UPRFoleyComponent::SetBreathingVirtual(bool bVirtual) {
+  if (bBreathingVirtual == bVirtual) {
+    return;
+  }
+  bBreathingVirtual = bVirtual;
+
+  if (bVirtual) {
+    FadeOutBreathing(VoiceData ? VoiceData->BreathingFadeTime : 0.5f);
+    return;
+  }
+
+  // Real again: resend every parameter, then fade in from the simulation
+  CachedBreathingIntensity = -1.0f;
+  CachedBreathRate = -1.0f;
+  CachedEffortLevel = -1.0f;
+  CachedRecoveryPhase = -1.0f;
+  if (!bBreathingAsleep) {
+    UpdateBreathingLoop();
+  }
+}
+
+void UPRFoleyComponent::SuspendBreathing() {
+  if (bBreathingAsleep) {
+    return;
+  }
+  bBreathingAsleep = true;
+  BreathingSleepTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+  // Out of breathing range: silence the sources instead of updating them.
+  // MetaSound parameters stay on the component and are reapplied on Play;
+  // tier loops stay primed, paused.
+  FadeOutBreathing(0.5f);
+  SetComponentTickEnabled(false);
+
+  // Wakes up silent; the next voice ranking decides
+  if (GetDefault<UPRFoleySettings>()->MaxRealBreathingVoices > 0) {
+    bBreathingVirtual = true;
   }
 }
 
+void UPRFoleyComponent::ResumeBreathing() {
+  if (!bBreathingAsleep) {
+    return;
+  }
+  bBreathingAsleep = false;
+
+  // Recovery kept running while asleep
+  if (const UWorld *World = GetWorld()) {
+    const float Slept =
+        static_cast<float>(World->GetTimeSeconds() - BreathingSleepTime);
+    RecoveryTimeRemaining = FMath::Max(RecoveryTimeRemaining - Slept, 0.0f);
+    if (RecoveryTimeRemaining <= 0.0f) {
+      RecoveryPhaseValue = 0.0f;
+    }
+  }
+
+  SetComponentTickEnabled(true);
+  UpdateBreathingLoop();
+}
+
 // ============================================================================
 // Surface Sound Playback
 // ============================================================================
 
 void UPRFoleyComponent::PlaySurfaceFootstep(EPhysicalSurface SurfaceType,
                                             const FVector &SurfaceLocation) {
-  if (!FootstepData || !bEnableFootstepLayer) {
+  if (!FootstepData || !bEnableFootstepLayer || IsServerStripped()) {
     return;
   }
 
-  bool bDefault = false;
-  const FPRSurfaceFoleyConfig *Config =
-      ResolveSurfaceConfig(FootstepData->Surfaces, SurfaceType, bDefault);
-  if (!Config) {
+  const FPRResolvedSurface &Resolved =
+      FootstepData->GetResolvedSurface(SurfaceType);
+  if (!Resolved.Footstep) {
     return;
   }
 
-  const EPhysicalSurface Key = bDefault ? SurfaceType_Default : SurfaceType;
-  int32 &LastIndex = LastSurfaceFootstepIndices.FindOrAdd(Key, INDEX_NONE);
-  USoundBase *SurfaceSound = SelectSoundFromSet(Config->Footstep, LastIndex);
+  int32 &LastIndex =
+      LastSurfaceFootstepIndices.FindOrAdd(Resolved.FootstepKey, INDEX_NONE);
+  USoundBase *SurfaceSound = SelectSoundFromSet(*Resolved.Footstep, LastIndex);
 
   FPRFoleyAudioSettings AdjustedSettings = FootstepData->SurfaceAudio;
-  AdjustedSettings.VolumeRange *= Config->VolumeMultiplier;
-  AdjustedSettings.PitchRange *= Config->PitchMultiplier;
+  AdjustedSettings.VolumeRange = Resolved.VolumeRange;
+  AdjustedSettings.PitchRange = Resolved.PitchRange;
 
-  float Vol =
-      PlaySoundWithSettings(SurfaceSound, SurfaceLocation, AdjustedSettings);
+  float Vol = PlaySurfaceSound(SurfaceSound, SurfaceLocation, AdjustedSettings,
+                               SurfaceType, EPRFoleyEventType::Footstep);
   if (SurfaceSound) {
     OnFootstepPlayed.Broadcast(SurfaceType, SurfaceLocation, Vol, SurfaceSound);
   }
@@ -1260,34 +1991,24 @@ void UPRFoleyComponent::PlaySurfaceFootstep(EPhysicalSurface SurfaceType,
 
 void UPRFoleyComponent::PlaySurfaceJump(EPhysicalSurface SurfaceType,
                                         const FVector &SurfaceLocation) {
-  if (!FootstepData || !bEnableFootstepLayer) {
+  if (!FootstepData || !bEnableFootstepLayer || IsServerStripped()) {
     return;
   }
 
-  bool bDefaultJump = false;
-  const FPRSurfaceFoleyConfig *Config =
-      ResolveSurfaceConfig(FootstepData->Surfaces, SurfaceType, bDefaultJump);
-
-  const FPRSurfaceSoundSet *SoundSetToUse = &FootstepData->GlobalJumpLaunch;
-  EPhysicalSurface IndexKey = SurfaceType_Default;
-
-  if (Config && Config->bOverrideJump) {
-    SoundSetToUse = &Config->JumpLaunch;
-    IndexKey = bDefaultJump ? SurfaceType_Default : SurfaceType;
-  }
+  const FPRResolvedSurface &Resolved =
+      FootstepData->GetResolvedSurface(SurfaceType);
 
-  if (SoundSetToUse) {
-    int32 &LastIndex = LastSurfaceJumpIndices.FindOrAdd(IndexKey, INDEX_NONE);
+  if (const FPRSurfaceSoundSet *SoundSetToUse = Resolved.JumpLaunch) {
+    int32 &LastIndex =
+        LastSurfaceJumpIndices.FindOrAdd(Resolved.JumpKey, INDEX_NONE);
     USoundBase *JumpSound = SelectSoundFromSet(*SoundSetToUse, LastIndex);
 
     FPRFoleyAudioSettings AdjustedSettings = FootstepData->SurfaceAudio;
-    if (Config) {
-      AdjustedSettings.VolumeRange *= Config->VolumeMultiplier;
-      AdjustedSettings.PitchRange *= Config->PitchMultiplier;
-    }
+    AdjustedSettings.VolumeRange = Resolved.VolumeRange;
+    AdjustedSettings.PitchRange = Resolved.PitchRange;
 
-    float Vol =
-        PlaySoundWithSettings(JumpSound, SurfaceLocation, AdjustedSettings);
+    float Vol = PlaySurfaceSound(JumpSound, SurfaceLocation, AdjustedSettings,
+                                 SurfaceType, EPRFoleyEventType::Jump);
     if (JumpSound) {
       OnFootstepPlayed.Broadcast(SurfaceType, SurfaceLocation, Vol, JumpSound);
     }
@@ -1298,34 +2019,24 @@ void UPRFoleyComponent::PlaySurfaceJump(EPhysicalSurface SurfaceType,
 
 void UPRFoleyComponent::PlaySurfaceLand(EPhysicalSurface SurfaceType,
                                         const FVector &SurfaceLocation) {
-  if (!FootstepData || !bEnableFootstepLayer) {
+  if (!FootstepData || !bEnableFootstepLayer || IsServerStripped()) {
     return;
   }
 
-  bool bDefaultLand = false;
-  const FPRSurfaceFoleyConfig *Config =
-      ResolveSurfaceConfig(FootstepData->Surfaces, SurfaceType, bDefaultLand);
-
-  const FPRSurfaceSoundSet *SoundSetToUse = &FootstepData->GlobalLandImpact;
-  EPhysicalSurface IndexKey = SurfaceType_Default;
-
-  if (Config && Config->bOverrideLand) {
-    SoundSetToUse = &Config->LandImpact;
-    IndexKey = bDefaultLand ? SurfaceType_Default : SurfaceType;
-  }
+  const FPRResolvedSurface &Resolved =
+      FootstepData->GetResolvedSurface(SurfaceType);
 
-  if (SoundSetToUse) {
-    int32 &LastIndex = LastSurfaceLandIndices.FindOrAdd(IndexKey, INDEX_NONE);
+  if (const FPRSurfaceSoundSet *SoundSetToUse = Resolved.LandImpact) {
+    int32 &LastIndex =
+        LastSurfaceLandIndices.FindOrAdd(Resolved.LandKey, INDEX_NONE);
     USoundBase *LandSound = SelectSoundFromSet(*SoundSetToUse, LastIndex);
 
     FPRFoleyAudioSettings AdjustedSettings = FootstepData->SurfaceAudio;
-    if (Config) {
-      AdjustedSettings.VolumeRange *= Config->VolumeMultiplier;
-      AdjustedSettings.PitchRange *= Config->PitchMultiplier;
-    }
+    AdjustedSettings.VolumeRange = Resolved.VolumeRange;
+    AdjustedSettings.PitchRange = Resolved.PitchRange;
 
-    float Vol =
-        PlaySoundWithSettings(LandSound, SurfaceLocation, AdjustedSettings);
+    float Vol = PlaySurfaceSound(LandSound, SurfaceLocation, AdjustedSettings,
+                                 SurfaceType, EPRFoleyEventType::Land);
     if (LandSound) {
       OnFootstepPlayed.Broadcast(SurfaceType, SurfaceLocation, Vol, LandSound);
     }
@@ -1342,26 +2053,7 @@ UPRFoleyComponent::ResolveVFXSet(EPhysicalSurface SurfaceType) const {
     return nullptr;
   }
 
-  // 1. Look for per-surface VFX
-  bool bDefault = false;
-  const FPRSurfaceFoleyConfig *Config =
-      ResolveSurfaceConfig(FootstepData->Surfaces, SurfaceType, bDefault);
-
-  if (Config) {
-    const FPRSurfaceVFXSet &SurfVFX = Config->VFX;
-    // If per-surface has at least one system configured, use it
-    if (SurfVFX.FootstepVFX || SurfVFX.JumpVFX || SurfVFX.LandVFX) {
-      return &SurfVFX;
-    }
-  }
-
-  // 2. Fallback to global DefaultVFX
-  const FPRSurfaceVFXSet &Def = FootstepData->DefaultVFX;
-  if (Def.FootstepVFX || Def.JumpVFX || Def.LandVFX) {
-    return &Def;
-  }
-
-  return nullptr;
+  return FootstepData->GetResolvedSurface(SurfaceType).VFX;
 }
 
 float UPRFoleyComponent::ComputeVFXScale(const FPRSurfaceVFXSet *VFXSet,
@@ -1401,6 +2093,9 @@ float UPRFoleyComponent::ComputeVFXScale(const FPRSurfaceVFXSet *VFXSet,
 void UPRFoleyComponent::SpawnVFX(UNiagaraSystem *System,
                                  const FVector &Location, const FVector &Normal,
                                  float Scale, EPhysicalSurface SurfaceType) {
+  SCOPE_CYCLE_COUNTER(STAT_PRFoley_SpawnVFX);
+  TRACE_CPUPROFILER_EVENT_SCOPE(PRFoley_SpawnVFX);
+
   if (!System || !GetWorld()) {
     return;
   }
@@ -1414,6 +2109,7 @@ void UPRFoleyComponent::SpawnVFX(UNiagaraSystem *System,
           ENCPoolMethod::AutoRelease, true);
 
   if (NiagaraComp) {
+    PRFOLEY_COUNT(VFXSpawned, 1);
     OnVFXSpawned.Broadcast(SurfaceType, Location, System);
   }
 }
@@ -1422,7 +2118,8 @@ void UPRFoleyComponent::PlaySurfaceVFX(EPhysicalSurface SurfaceType,
                                        const FVector &Location,
                                        const FVector &Normal,
                                        EPRFoleyEventType EventType) {
-  if (!bEnableVFXLayer || !FootstepData) {
+  if (!bEnableVFXLayer || !FootstepData ||
+      !IsLayerSignificant(EPRFoleyLayerMask::VFX)) {
     return;
   }
 
@@ -1434,13 +2131,13 @@ void UPRFoleyComponent::PlaySurfaceVFX(EPhysicalSurface SurfaceType,
   UNiagaraSystem *SystemToSpawn = nullptr;
   switch (EventType) {
   case EPRFoleyEventType::Footstep:
-    SystemToSpawn = VFXSet->FootstepVFX;
+    SystemToSpawn = VFXSet->FootstepVFX.Get();
     break;
   case EPRFoleyEventType::Jump:
-    SystemToSpawn = VFXSet->JumpVFX;
+    SystemToSpawn = VFXSet->JumpVFX.Get();
     break;
   case EPRFoleyEventType::Land:
-    SystemToSpawn = VFXSet->LandVFX;
+    SystemToSpawn = VFXSet->LandVFX.Get();
     break;
   }
 
@@ -1462,27 +2159,17 @@ UPRFoleyComponent::ResolveDecalSet(EPhysicalSurface SurfaceType) const {
     return nullptr;
   }
 
-  // 1. Per-surface decal
-  bool bDefault = false;
-  const FPRSurfaceFoleyConfig *Config =
-      ResolveSurfaceConfig(FootstepData->Surfaces, SurfaceType, bDefault);
-
-  if (Config && Config->Decal.DecalMaterial) {
-    return &Config->Decal;
-  }
-
-  // 2. Global fallback
-  if (FootstepData->DefaultDecal.DecalMaterial) {
-    return &FootstepData->DefaultDecal;
-  }
-
-  return nullptr;
+  return FootstepData->GetResolvedSurface(SurfaceType).Decal;
 }
 
 void UPRFoleyComponent::SpawnFootprintDecal(EPhysicalSurface SurfaceType,
                                             const FVector &Location,
                                             const FVector &Normal) {
-  if (!bEnableDecalLayer || !FootstepData) {
+  SCOPE_CYCLE_COUNTER(STAT_PRFoley_SpawnDecal);
+  TRACE_CPUPROFILER_EVENT_SCOPE(PRFoley_SpawnFootprintDecal);
+
+  if (!bEnableDecalLayer || !FootstepData ||
+      !IsLayerSignificant(EPRFoleyLayerMask::Decal)) {
     return;
   }
 
@@ -1491,7 +2178,7 @@ void UPRFoleyComponent::SpawnFootprintDecal(EPhysicalSurface SurfaceType,
   // trace within the #if WITH_EDITOR or just rely on Engine.h
 
   const FPRSurfaceDecalSet *DecalSet = ResolveDecalSet(SurfaceType);
-  if (!DecalSet || !DecalSet->DecalMaterial) {
+  if (!DecalSet || !DecalSet->DecalMaterial.Get()) {
     return;
   }
 
@@ -1539,9 +2226,49 @@ void UPRFoleyComponent::SpawnFootprintDecal(EPhysicalSurface SurfaceType,
     SpawnLocation += DecalRotation.RotateVector(DecalSet->DecalOffset);
   }
 
-  UDecalComponent *Decal = UGameplayStatics::SpawnDecalAtLocation(
-      this, DecalSet->DecalMaterial, DecalExtent, SpawnLocation, DecalRotation,
-      DecalSet->LifeSpan);
+  // Support Flipbook Texture Atlases
+  int32 Frame = INDEX_NONE;
+  if (!DecalSet->FrameIndexParamName.IsNone()) {
+    const TArray<int32> &TargetFrames = bIsRightFootprint
+                                            ? DecalSet->RightFootFrames
+                                            : DecalSet->LeftFootFrames;
+    if (TargetFrames.Num() > 0) {
+      Frame = TargetFrames[FMath::RandRange(0, TargetFrames.Num() - 1)];
+    }
+  }
+
+  if (FootstepData->FootprintBackend == EPRFootprintBackend::InstancedMesh &&
+      FootstepData->FootprintMesh) {
+    SpawnFootprintInstance(SurfaceType, *DecalSet, SpawnLocation, Normal,
+                           ForwardDir, Frame);
+    return;
+  }
+
+  UPRFoleyDecalPoolSubsystem *DecalPool =
+      GetWorld()->GetSubsystem<UPRFoleyDecalPoolSubsystem>();
+  if (!DecalPool) {
+    return;
+  }
+
+  FPRFoleyDecalSpawnParams Params;
+  Params.Material = DecalSet->DecalMaterial.Get();
+  Params.Extent = DecalExtent;
+  Params.Location = SpawnLocation;
+  Params.Rotation = DecalRotation;
+  Params.LifeSpan = DecalSet->LifeSpan;
+
+  // Hardcode FadeScreenSize to a tiny value to bypass aggressive engine
+  // culling which causes decals to be invisible if not set perfectly in the
+  // Data Asset or Project Settings.
+  Params.FadeScreenSize = 0.001f;
+
+  // One shared MID per frame in the pool
+  if (Frame != INDEX_NONE) {
+    Params.Frame = Frame;
+    Params.FrameParamName = DecalSet->FrameIndexParamName;
+  }
+
+  const FPRFoleyDecalHandle Handle = DecalPool->SpawnDecal(Params);
 
   if (bDebugTraces) {
     DrawDebugBox(GetWorld(), SpawnLocation, DecalExtent,
@@ -1551,69 +2278,115 @@ void UPRFoleyComponent::SpawnFootprintDecal(EPhysicalSurface SurfaceType,
                   false, 2.0f, 0, 1.0f);
   }
 
-  if (Decal) {
-    // Hardcode FadeScreenSize to a tiny value to bypass aggressive engine
-    // culling which causes decals to be invisible if not set perfectly in the
-    // Data Asset or Project Settings.
-    Decal->SetFadeScreenSize(0.001f);
-
-    // Support Flipbook Texture Atlases
-    if (!DecalSet->FrameIndexParamName.IsNone()) {
-      const TArray<int32> &TargetFrames = bIsRightFootprint
-                                              ? DecalSet->RightFootFrames
-                                              : DecalSet->LeftFootFrames;
-      if (TargetFrames.Num() > 0) {
-        int32 RandomIndex = FMath::RandRange(0, TargetFrames.Num() - 1);
-        int32 SelectedFrame = TargetFrames[RandomIndex];
-
-        UMaterialInstanceDynamic *MID = Decal->CreateDynamicMaterialInstance();
-        if (MID) {
-          MID->SetScalarParameterValue(DecalSet->FrameIndexParamName,
-                                       static_cast<float>(SelectedFrame));
-        }
-      }
-    }
-
+  if (Handle.IsValid()) {
     // Toggle foot side for next step
     bIsRightFootprint = !bIsRightFootprint;
 
-    // Pool management: enforce MaxActiveDecals
-    ActiveDecals.Add(Decal);
-
-    // Clean up expired weak pointers
-    ActiveDecals.RemoveAll([](const TWeakObjectPtr<UDecalComponent> &Ptr) {
-      return !Ptr.IsValid();
-    });
-
-    // Remove oldest if over limit
-    while (ActiveDecals.Num() > FootstepData->MaxActiveDecals) {
-      if (ActiveDecals[0].IsValid()) {
-        ActiveDecals[0]->DestroyComponent();
-      }
-      ActiveDecals.RemoveAt(0);
+    // Per-component cap: MaxActiveDecals handles in a ring, oldest released.
+    // A handle whose slot was already recycled by the pool is a no-op.
+    const int32 MaxOwned = FMath::Max(1, FootstepData->MaxActiveDecals);
+    if (OwnedDecals.Num() < MaxOwned) {
+      OwnedDecals.Add(Handle);
+    } else {
+      NextOwnedDecal %= OwnedDecals.Num();
+      DecalPool->ReleaseDecal(OwnedDecals[NextOwnedDecal]);
+      OwnedDecals[NextOwnedDecal] = Handle;
+      NextOwnedDecal = (NextOwnedDecal + 1) % OwnedDecals.Num();
     }
 
     OnDecalSpawned.Broadcast(SurfaceType, SpawnLocation);
   }
 }
 
+void UPRFoleyComponent::SpawnFootprintInstance(
+    EPhysicalSurface SurfaceType, const FPRSurfaceDecalSet &DecalSet,
+    const FVector &Location, const FVector &Normal, const FVector &ForwardDir,
+    int32 Frame) {
+  UPRFoleyFootprintSubsystem *Footprints =
+      GetWorld()->GetSubsystem<UPRFoleyFootprintSubsystem>();
+  if (!Footprints) {
+    return;
+  }
+
+  // The quad lies in XY: Z along the surface normal, X along the movement.
+  const FVector Up = Normal.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+  const FQuat Rotation = FRotationMatrix::MakeFromZX(Up, ForwardDir).ToQuat();
+
+  // Plane mesh is 100x100 units; DecalSize is (width, length). Lift it a
+  // little off the ground to avoid z-fighting.
+  const FVector Scale(DecalSet.DecalSize.Y / 100.0f,
+                      DecalSet.DecalSize.X / 100.0f, 1.0f);
+  const FTransform Transform(Rotation, Location + Up * 0.5f, Scale);
+
+  if (bDebugTraces) {
+    DrawDebugCoordinateSystem(GetWorld(), Transform.GetLocation(),
+                              Rotation.Rotator(), 20.0f, false, 2.0f);
+  }
+
+  if (Footprints->AddFootprint(FootstepData->FootprintMesh,
+                               DecalSet.DecalMaterial.Get(), Transform, Frame,
+                               DecalSet.LifeSpan)) {
+    bIsRightFootprint = !bIsRightFootprint;
+    OnDecalSpawned.Broadcast(SurfaceType, Location);
+  }
+}
+
 // ============================================================================
 // Landscape Blending
 // ============================================================================
 
+bool UPRFoleyComponent::SampleLandscapeSurfaces(
+    const FHitResult &Hit, FPRLandscapeSurfaceSample &OutSample) const {
+  if (!FootstepData || !FootstepData->bUseLandscapeWeightmaps ||
+      !Hit.GetActor() || !Hit.GetActor()->IsA<ALandscapeProxy>()) {
+    return false;
+  }
+  UWorld *World = GetWorld();
+  UPRFoleyLandscapeSubsystem *Landscapes =
+      World ? World->GetSubsystem<UPRFoleyLandscapeSubsystem>() : nullptr;
+  return Landscapes && Landscapes->SampleSurfaces(Hit, OutSample);
+}
+
 bool UPRFoleyComponent::GetLandscapeBlendSurface(
     const FHitResult &Hit, EPhysicalSurface &OutSecondarySurface,
     float &OutSecondaryWeight) const {
+  SCOPE_CYCLE_COUNTER(STAT_PRFoley_LandscapeBlend);
+  TRACE_CPUPROFILER_EVENT_SCOPE(PRFoley_GetLandscapeBlendSurface);
+
   if (!FootstepData || !FootstepData->bEnableLandscapeBlending) {
     return false;
   }
 
+  // Surface grid hits carry no actor: the baked cell holds the blend
+  if (!Hit.GetActor()) {
+    const UWorld *World = GetWorld();
+    const UPRFoleySurfaceGridSubsystem *SurfaceGrid =
+        World ? World->GetSubsystem<UPRFoleySurfaceGridSubsystem>() : nullptr;
+    return SurfaceGrid &&
+           SurfaceGrid->GetBlendSurface(Hit.ImpactPoint, OutSecondarySurface,
+                                        OutSecondaryWeight) &&
+           OutSecondarySurface != SurfaceType_Default &&
+           OutSecondaryWeight >= FootstepData->LandscapeBlendThreshold;
+  }
+
   // Only applies to Landscape actors
   ALandscapeProxy *Landscape = Cast<ALandscapeProxy>(Hit.GetActor());
   if (!Landscape) {
     return false;
   }
 
+  // Weightmap fast path: real blend weights, no scene query
+  FPRLandscapeSurfaceSample Sample;
+  if (SampleLandscapeSurfaces(Hit, Sample)) {
+    if (Sample.SecondarySurface == SurfaceType_Default ||
+        Sample.SecondaryWeight < FootstepData->LandscapeBlendThreshold) {
+      return false;
+    }
+    OutSecondarySurface = Sample.SecondarySurface;
+    OutSecondaryWeight = Sample.SecondaryWeight;
+    return true;
+  }
+
   EPhysicalSurface PrimarySurface =
       Hit.PhysMaterial.IsValid() ? static_cast<EPhysicalSurface>(
                                        Hit.PhysMaterial->SurfaceType.GetValue())
@@ -1639,9 +2412,7 @@ bool UPRFoleyComponent::GetLandscapeBlendSurface(
     TMap<EPhysicalSurface, int32> SurfaceCounts;
     int32 TotalValidHits = 0;
 
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(GetOwner());
-    Params.bReturnPhysicalMaterial = true;
+    const FCollisionQueryParams &Params = FoleyQueryParams;
     ECollisionChannel Channel = FootstepData->TraceChannel.GetValue();
 
     UWorld *World = GetWorld();
@@ -1656,6 +2427,7 @@ bool UPRFoleyComponent::GetLandscapeBlendSurface(
     }
 
     // Cast 4 peripheral traces
+    PRFOLEY_COUNT(TracesIssued, 4);
     for (int i = 0; i < 4; ++i) {
       FVector Start = Points[i] + HitNormal * TraceZOffset;
       FVector End = Points[i] - HitNormal * TraceZOffset;
@@ -1707,56 +2479,38 @@ bool UPRFoleyComponent::GetLandscapeBlendSurface(
     return false;
   }
 
-  // Fallback to legacy layer allocation estimation
-  ULandscapeHeightfieldCollisionComponent *CollisionComp =
-      Cast<ULandscapeHeightfieldCollisionComponent>(Hit.GetComponent());
-  if (!CollisionComp) {
-    return false;
-  }
-
-  ULandscapeComponent *LandComp = CollisionComp->GetRenderComponent();
-  if (!LandComp) {
-    return false;
-  }
-
-  const TArray<FWeightmapLayerAllocationInfo> &Allocations =
-      LandComp->GetWeightmapLayerAllocations();
-  if (Allocations.Num() < 2) {
-    return false;
-  }
+  return false;
+}
 
-  struct FLayerWeight {
-    EPhysicalSurface Surface;
-    float Weight;
-  };
+// ============================================================================
+// AI Noise
+// ============================================================================
 
-  TArray<FLayerWeight> LayerWeights;
-  for (const FWeightmapLayerAllocationInfo &Alloc : Allocations) {
-    if (Alloc.LayerInfo) {
-      UPhysicalMaterial *PhysMat = Alloc.LayerInfo->GetPhysicalMaterial();
-      if (PhysMat) {
-        FLayerWeight LW;
-        LW.Surface = PhysMat->SurfaceType;
-        LW.Weight = 0.0f;
-        LayerWeights.Add(LW);
-      }
-    }
+void UPRFoleyComponent::ReportFoleyNoise(EPhysicalSurface SurfaceType,
+                                         const FVector &Location,
+                                         EPRFoleyEventType EventType,
+                                         bool bHeavyLand) {
+  if (!ReportsAINoise()) {
+    return;
   }
 
-  if (LayerWeights.Num() < 2) {
-    return false;
+  UWorld *World = GetWorld();
+  UPRFoleyNoiseSubsystem *Noise =
+      World ? World->GetSubsystem<UPRFoleyNoiseSubsystem>() : nullptr;
+  if (!Noise) {
+    return;
   }
 
-  for (const FLayerWeight &LW : LayerWeights) {
-    if (LW.Surface != PrimarySurface && LW.Surface != SurfaceType_Default) {
-      OutSecondarySurface = LW.Surface;
-      // In old fallback, assume weight passes threshold
-      OutSecondaryWeight = FootstepData->LandscapeBlendThreshold + 0.1f;
-      return true;
-    }
+  const FPRResolvedSurface &Resolved =
+      FootstepData->GetResolvedSurface(SurfaceType);
+  float Loudness = FootstepData->NoiseLoudness *
+                   (Resolved.Config ? Resolved.Config->VolumeMultiplier : 1.0f);
+  if (EventType == EPRFoleyEventType::Land) {
+    Loudness *= FootstepData->LandNoiseMultiplier * (bHeavyLand ? 2.0f : 1.0f);
   }
 
-  return false;
+  Noise->ReportNoise(GetOwner(), Location, Loudness,
+                     FootstepData->NoiseMaxRange);
 }
 
 // ============================================================================
@@ -1777,32 +2531,166 @@ void UPRFoleyComponent::BroadcastNetworkFoleyEvent(EPhysicalSurface SurfaceType,
     return;
   }
 
-  const EPRVelocityTier Tier = GetVelocityTier();
+  // Local simulation: everyone already runs its own detection; only the
+  // authority's lands are sent
+  if (UsesLocalSimulation() &&
+      (EventType != EPRFoleyEventType::Land || !Owner->HasAuthority())) {
+    return;
+  }
 
-  // If we are the server (listen server or dedicated), call multicast directly
-  if (Owner->HasAuthority()) {
-    Multicast_FoleyEvent(SurfaceType, Location, Normal, EventType, Tier,
-                         bHeavyLand);
+  FPRFoleyNetEvent Event;
+  Event.Location = Location;
+  Event.Normal = Normal;
+  Event.Surface = SurfaceType;
+  Event.EventType = EventType;
+  Event.VelocityTier = GetVelocityTier();
+  Event.bHeavyLand = bHeavyLand;
+  Event.Time = (GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0) +
+               StepStartDelay;
+  QueueNetEvent(Event);
+}
+
+void UPRFoleyComponent::QueueNetEvent(const FPRFoleyNetEvent &Event) {
+  AActor *Owner = GetOwner();
+  if (!Owner || GetNetMode() == NM_Standalone) {
+    return;
+  }
+
+  // Cosmetic: past the batch size, the oldest event is the least useful
+  if (PendingNetEvents.Num() < FPRFoleyNetEventBatch::MaxEvents) {
+    PendingNetEvents.Add(Event);
   } else {
-    // Client: send to server which will multicast
-    Server_FoleyEvent(SurfaceType, Location, Normal, EventType, Tier,
-                      bHeavyLand);
+    PendingNetEvents[NextNetEvent] = Event;
+    NextNetEvent = (NextNetEvent + 1) % FPRFoleyNetEventBatch::MaxEvents;
+  }
+
+  // Clients have no net update of their own to hook: flush at its rate
+  UWorld *World = GetWorld();
+  if (!Owner->HasAuthority() && World &&
+      !World->GetTimerManager().IsTimerActive(NetFlushTimerHandle)) {
+    World->GetTimerManager().SetTimer(
+        NetFlushTimerHandle, this, &UPRFoleyComponent::FlushNetEvents,
+        1.0f / FMath::Max(Owner->GetNetUpdateFrequency(), 1.0f), false);
+  }
+}
+
+void UPRFoleyComponent::PreReplication(
+    IRepChangedPropertyTracker &ChangedPropertyTracker) {
+  Super::PreReplication(ChangedPropertyTracker);
+  FlushNetEvents();
+}
+
+void UPRFoleyComponent::FlushNetEvents() {
+  AActor *Owner = GetOwner();
+  if (!Owner || PendingNetEvents.Num() == 0) {
+    return;
+  }
+
+  FPRFoleyNetEventBatch Batch;
+  Batch.Origin = Owner->GetActorLocation();
+  Batch.Events = MoveTemp(PendingNetEvents);
+  PendingNetEvents.Reset();
+  NextNetEvent = 0;
+
+  // Held while dormant or not relevant: too late to be worth playing
+  if (const UWorld *World = GetWorld()) {
+    const double Oldest =
+        World->GetTimeSeconds() -
+        1.0 / FMath::Max(Owner->GetMinNetUpdateFrequency(), 1.0f);
+    Batch.Events.RemoveAllSwap(
+        [Oldest](const FPRFoleyNetEvent &Event) {
+          return Event.Time < Oldest;
+        },
+        EAllowShrinking::No);
+  }
+  if (Batch.Events.Num() == 0) {
+    return;
+  }
+
+  // Receivers replay the events with the spacing they happened at. A full
+  // ring is not in time order, so offsets start from the earliest event.
+  double FirstTime = Batch.Events[0].Time;
+  for (const FPRFoleyNetEvent &Event : Batch.Events) {
+    FirstTime = FMath::Min(FirstTime, Event.Time);
+  }
+  for (FPRFoleyNetEvent &Event : Batch.Events) {
+    Event.TimeOffset = static_cast<float>(Event.Time - FirstTime);
+  }
+
+  if (!Owner->HasAuthority()) {
+    // Client: send to server which will relay it on its next net update
+    PRFOLEY_COUNT(RPCsSent, 1);
+    Server_FoleyEvents(Batch);
+    return;
   }
+
+  // Server: only the connections within range get the batch
+  const float Range = GetNetEventRange();
+  if (GetDefault<UPRFoleySettings>()->bRouteNetEventsByRange &&
+      Range > 0.0f) {
+    if (UPRFoleyNetRelaySubsystem *Relay =
+            UWorld::GetSubsystem<UPRFoleyNetRelaySubsystem>(GetWorld())) {
+      Relay->RouteEvents(*this, Batch, Range);
+      return;
+    }
+  }
+
+  PRFOLEY_COUNT(RPCsSent, 1);
+  Multicast_FoleyEvents(Batch);
 }
 
-void UPRFoleyComponent::Server_FoleyEvent_Implementation(
-    EPhysicalSurface SurfaceType, FVector_NetQuantize Location,
-    FVector_NetQuantizeNormal Normal, EPRFoleyEventType EventType,
-    EPRVelocityTier VelocityTier, bool bHeavyLand) {
-  // Server received from client → broadcast to all
-  Multicast_FoleyEvent(SurfaceType, Location, Normal, EventType, VelocityTier,
-                       bHeavyLand);
+float UPRFoleyComponent::GetNetEventRange() const {
+  if (!FootstepData || FootstepData->MaxLODDistance <= 0.0f) {
+    return 0.0f;
+  }
+
+  // Receivers cull everything past MaxLODDistance (IsInLODRadius)
+  const float LODRange = FootstepData->MaxLODDistance;
+  const auto LayerRange = [LODRange](float Distance) {
+    return Distance > 0.0f ? FMath::Min(Distance, LODRange) : LODRange;
+  };
+
+  float AudioRange = LODRange;
+  if (const USoundAttenuation *Attenuation =
+          FootstepData->SurfaceAudio.AttenuationSettings) {
+    if (Attenuation->Attenuation.bAttenuate) {
+      AudioRange = LayerRange(Attenuation->Attenuation.GetMaxDimension());
+    }
+  }
+
+  const float Range = FMath::Max(
+      {AudioRange, LayerRange(FootstepData->VFXMaxDistance),
+       LayerRange(FootstepData->DecalMaxDistance),
+       LayerRange(FootstepData->BreathingMaxDistance)});
+  return Range + GetDefault<UPRFoleySettings>()->NetEventRangeMargin;
 }
 
-void UPRFoleyComponent::Multicast_FoleyEvent_Implementation(
-    EPhysicalSurface SurfaceType, FVector_NetQuantize Location,
-    FVector_NetQuantizeNormal Normal, EPRFoleyEventType EventType,
-    EPRVelocityTier VelocityTier, bool bHeavyLand) {
+void UPRFoleyComponent::Server_FoleyEvents_Implementation(
+    const FPRFoleyNetEventBatch &Batch) {
+  const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+  for (FPRFoleyNetEvent Event : Batch.Events) {
+    // Relayed with the client's spacing, rebased on the server clock
+    Event.Time = Now + Event.TimeOffset;
+    QueueNetEvent(Event);
+  }
+}
+
+void UPRFoleyComponent::Multicast_FoleyEvents_Implementation(
+    const FPRFoleyNetEventBatch &Batch) {
+  ReceiveFoleyEvents(Batch);
+}
+
+void UPRFoleyComponent::ReceiveFoleyEvents(
+    const FPRFoleyNetEventBatch &Batch) {
+  if (IsServerStripped()) {
+    return;
+  }
+
+  // Local simulation: only simulated proxies did not detect it themselves
+  if (UsesLocalSimulation() && GetOwnerRole() != ROLE_SimulatedProxy) {
+    return;
+  }
+
   // Skip on the local client that originated the event (already played locally)
   if (APawn *OwnerPawn = Cast<APawn>(GetOwner())) {
     if (OwnerPawn->IsLocallyControlled()) {
@@ -1810,9 +2698,31 @@ void UPRFoleyComponent::Multicast_FoleyEvent_Implementation(
     }
   }
 
-  // Remote client: play sound + VFX from DataAsset
-  PlayRemoteFoleyEvent(SurfaceType, FVector(Location), FVector(Normal),
-                       EventType, VelocityTier, bHeavyLand);
+  // Remote client: play sound + VFX from DataAsset, spread over the net
+  // update the way they happened instead of all on the receiving frame
+  UWorld *World = GetWorld();
+  for (const FPRFoleyNetEvent &Event : Batch.Events) {
+    if (Event.TimeOffset <= 0.0f || !World) {
+      PlayRemoteFoleyEvent(Event);
+      continue;
+    }
+    FTimerHandle Handle;
+    World->GetTimerManager().SetTimer(
+        Handle,
+        FTimerDelegate::CreateWeakLambda(
+            this, [this, Event]() { PlayRemoteFoleyEvent(Event); }),
+        Event.TimeOffset, false);
+  }
+}
+
+void UPRFoleyComponent::PlayRemoteFoleyEvent(const FPRFoleyNetEvent &Event) {
+  PlayRemoteFoleyEvent(Event.Surface, Event.Location, Event.Normal,
+                       Event.EventType, Event.VelocityTier, Event.bHeavyLand);
+}
+
+bool UPRFoleyComponent::UsesLocalSimulation() const {
+  return bEnableNetworkReplication &&
+         NetworkMode == EPRFoleyNetMode::LocalSimulation;
 }
 
 void UPRFoleyComponent::PlayRemoteFoleyEvent(EPhysicalSurface SurfaceType,
@@ -1826,6 +2736,8 @@ void UPRFoleyComponent::PlayRemoteFoleyEvent(EPhysicalSurface SurfaceType,
     return;
   }
 
+  SurfaceType = StreamSurface(SurfaceType);
+
   // --- Audio ---
   if (bEnableFootstepLayer && FootstepData) {
     switch (EventType) {
@@ -1841,8 +2753,11 @@ void UPRFoleyComponent::PlayRemoteFoleyEvent(EPhysicalSurface SurfaceType,
     }
   }
 
+  const bool bVoiceSignificant = bEnableVoiceLayer && VoiceData &&
+                                 IsLayerSignificant(EPRFoleyLayerMask::Voice);
+
   // --- Voice (land exhale on remote) ---
-  if (bEnableVoiceLayer && VoiceData && EventType == EPRFoleyEventType::Land) {
+  if (bVoiceSignificant && EventType == EPRFoleyEventType::Land) {
     USoundBase *ExhaleSound = bHeavyLand && VoiceData->HeavyLandExhale
                                   ? VoiceData->HeavyLandExhale
                                   : VoiceData->LandExhale;
@@ -1850,7 +2765,7 @@ void UPRFoleyComponent::PlayRemoteFoleyEvent(EPhysicalSurface SurfaceType,
   }
 
   // --- Voice (jump effort on remote) ---
-  if (bEnableVoiceLayer && VoiceData && EventType == EPRFoleyEventType::Jump) {
+  if (bVoiceSignificant && EventType == EPRFoleyEventType::Jump) {
     PlaySoundWithSettings(VoiceData->JumpEffort, Location,
                           VoiceData->VoiceAudio);
   }
@@ -0,0 +1,14 @@
+#include "PRFoleyNetRelayComponent.h"
+#include "PRFoleyComponent.h"
+
+UPRFoleyNetRelayComponent::UPRFoleyNetRelayComponent() {
+  PrimaryComponentTick.bCanEverTick = false;
+  SetIsReplicatedByDefault(true);
+}
+
+void UPRFoleyNetRelayComponent::Client_FoleyEvents_Implementation(
+    UPRFoleyComponent *Source, const FPRFoleyNetEventBatch &Batch) {
+  if (Source) {
+    Source->ReceiveFoleyEvents(Batch);
+  }
+}
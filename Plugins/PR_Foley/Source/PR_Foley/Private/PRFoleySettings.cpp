@@ -0,0 +1,6 @@
+#include "PRFoleySettings.h"
+
+UPRFoleySettings::UPRFoleySettings() {
+  CategoryName = TEXT("Plugins");
+  SectionName = TEXT("PR Foley");
+}
@@ -0,0 +1,8 @@
+#include "PRFoleyStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(PR_FOLEY_API, PRFoley, true);
+
+FPRFoleyCounters &FPRFoleyCounters::Get() {
+  static FPRFoleyCounters Counters;
+  return Counters;
+}
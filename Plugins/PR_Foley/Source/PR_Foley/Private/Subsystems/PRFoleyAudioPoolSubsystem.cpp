@@ -0,0 +1,108 @@
+#include "Subsystems/PRFoleyAudioPoolSubsystem.h"
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "PRFoleySettings.h"
+#include "Sound/SoundBase.h"
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleyAudioPoolSubsystem::Deinitialize() {
+  for (UAudioComponent *Component : Components) {
+    if (IsValid(Component)) {
+      Component->OnAudioFinishedNative.RemoveAll(this);
+      Component->Stop();
+      Component->DestroyComponent();
+    }
+  }
+  Components.Empty();
+  FreeComponents.Empty();
+  Super::Deinitialize();
+}
+
+// ============================================================================
+// Playback
+// ============================================================================
+
+UAudioComponent *UPRFoleyAudioPoolSubsystem::AcquireComponent(
+    const USoundEffectSourcePresetChain *EffectsChain) {
+  // Prefer a free component that already carries the chain
+  for (int32 Index = FreeComponents.Num() - 1; Index >= 0; --Index) {
+    UAudioComponent *Component = FreeComponents[Index];
+    if (!IsValid(Component)) {
+      FreeComponents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+      continue;
+    }
+    if (Component->SourceEffectChain == EffectsChain) {
+      FreeComponents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+      return Component;
+    }
+  }
+
+  if (FreeComponents.Num() > 0) {
+    return FreeComponents.Pop(EAllowShrinking::No);
+  }
+
+  UWorld *World = GetWorld();
+  if (!World || Components.Num() >=
+                    GetDefault<UPRFoleySettings>()->MaxPooledAudioComponents) {
+    return nullptr;
+  }
+
+  UAudioComponent *Component = NewObject<UAudioComponent>(World);
+  Component->bAutoActivate = false;
+  Component->bAutoDestroy = false;
+  Component->bAllowSpatialization = true;
+  Component->bStopWhenOwnerDestroyed = false;
+  Component->RegisterComponentWithWorld(World);
+  Component->OnAudioFinishedNative.AddUObject(
+      this, &UPRFoleyAudioPoolSubsystem::OnComponentFinished);
+  Components.Add(Component);
+  return Component;
+}
+
+void UPRFoleyAudioPoolSubsystem::OnComponentFinished(
+    UAudioComponent *Component) {
+  if (IsValid(Component)) {
+    FreeComponents.AddUnique(Component);
+  }
+}
+
+void UPRFoleyAudioPoolSubsystem::PlaySound(
+    USoundBase *Sound, const FVector &Location, float Volume, float Pitch,
+    const FPRFoleyAudioSettings &AudioSettings) {
+  if (!Sound) {
+    return;
+  }
+
+  UAudioComponent *Component = AcquireComponent(AudioSettings.EffectsChain);
+  if (!Component) {
+    // Pool exhausted: same behavior as before pooling
+    if (UAudioComponent *SpawnedAudio = UGameplayStatics::SpawnSoundAtLocation(
+            this, Sound, Location, FRotator::ZeroRotator, Volume, Pitch, 0.0f,
+            AudioSettings.AttenuationSettings,
+            AudioSettings.ConcurrencySettings, false)) {
+      if (AudioSettings.EffectsChain) {
+        SpawnedAudio->SetSourceEffectChain(AudioSettings.EffectsChain);
+      }
+      SpawnedAudio->Play();
+    }
+    return;
+  }
+
+  Component->SetWorldLocation(Location);
+  Component->SetSound(Sound);
+  Component->SetVolumeMultiplier(Volume);
+  Component->SetPitchMultiplier(Pitch);
+  Component->AttenuationSettings = AudioSettings.AttenuationSettings;
+  Component->ConcurrencySet.Reset();
+  if (AudioSettings.ConcurrencySettings) {
+    Component->ConcurrencySet.Add(AudioSettings.ConcurrencySettings);
+  }
+  if (Component->SourceEffectChain != AudioSettings.EffectsChain) {
+    Component->SetSourceEffectChain(AudioSettings.EffectsChain);
+  }
+  Component->Play();
+}
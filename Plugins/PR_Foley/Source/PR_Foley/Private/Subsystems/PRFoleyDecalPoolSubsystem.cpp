@@ -0,0 +1,179 @@
+#include "Subsystems/PRFoleyDecalPoolSubsystem.h"
+#include "Components/DecalComponent.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "PRFoleySettings.h"
+#include "PRFoleyStats.h"
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleyDecalPoolSubsystem::Deinitialize() {
+  for (UDecalComponent *Decal : Decals) {
+    if (IsValid(Decal)) {
+      Decal->DestroyComponent();
+    }
+  }
+  Decals.Empty();
+  ExpireTimes.Empty();
+  Serials.Empty();
+  FrameMIDs.Empty();
+  FrameMIDIndices.Empty();
+  NextSlot = 0;
+  NumActive = 0;
+  Super::Deinitialize();
+}
+
+bool UPRFoleyDecalPoolSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UPRFoleyDecalPoolSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UPRFoleyDecalPoolSubsystem,
+                                  STATGROUP_PRFoley);
+}
+
+// ============================================================================
+// Expiry
+// ============================================================================
+
+void UPRFoleyDecalPoolSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+  TRACE_CPUPROFILER_EVENT_SCOPE(UPRFoleyDecalPoolSubsystem_Tick);
+
+  const UWorld *World = GetWorld();
+  if (!World) {
+    return;
+  }
+
+  const double Now = World->GetTimeSeconds();
+  for (int32 Slot = 0; Slot < ExpireTimes.Num(); ++Slot) {
+    if (ExpireTimes[Slot] > 0.0 && ExpireTimes[Slot] <= Now) {
+      DeactivateSlot(Slot);
+    }
+  }
+
+  CSV_CUSTOM_STAT(PRFoley, DecalsAlive, NumActive, ECsvCustomStatOp::Set);
+}
+
+void UPRFoleyDecalPoolSubsystem::DeactivateSlot(int32 Slot) {
+  if (ExpireTimes[Slot] <= 0.0) {
+    return;
+  }
+  ExpireTimes[Slot] = 0.0;
+  --NumActive;
+
+  if (UDecalComponent *Decal = Decals[Slot]) {
+    Decal->SetVisibility(false);
+  }
+}
+
+// ============================================================================
+// Spawning
+// ============================================================================
+
+UDecalComponent *UPRFoleyDecalPoolSubsystem::CreateDecal() const {
+  UWorld *World = GetWorld();
+  UDecalComponent *Decal = NewObject<UDecalComponent>(World);
+  Decal->bAllowAnyoneToDestroyMe = true;
+  Decal->RegisterComponentWithWorld(World);
+  return Decal;
+}
+
+UDecalComponent *UPRFoleyDecalPoolSubsystem::AcquireSlot(int32 &OutSlot) {
+  if (!GetWorld()) {
+    return nullptr;
+  }
+
+  // Grow lazily up to capacity; past that the ring reuses the oldest slot.
+  const int32 Capacity =
+      FMath::Max(1, GetDefault<UPRFoleySettings>()->MaxPooledDecals);
+  if (Decals.Num() < Capacity) {
+    OutSlot = Decals.Add(CreateDecal());
+    ExpireTimes.Add(0.0);
+    Serials.Add(0);
+    return Decals[OutSlot];
+  }
+
+  OutSlot = NextSlot % Decals.Num();
+  NextSlot = (OutSlot + 1) % Decals.Num();
+
+  // Still visible: this is the ring eviction.
+  DeactivateSlot(OutSlot);
+
+  if (!IsValid(Decals[OutSlot])) {
+    Decals[OutSlot] = CreateDecal();
+  }
+  return Decals[OutSlot];
+}
+
+FPRFoleyDecalHandle
+UPRFoleyDecalPoolSubsystem::SpawnDecal(const FPRFoleyDecalSpawnParams &Params) {
+  FPRFoleyDecalHandle Handle;
+  if (!Params.Material) {
+    return Handle;
+  }
+
+  int32 Slot = INDEX_NONE;
+  UDecalComponent *Decal = AcquireSlot(Slot);
+  if (!Decal) {
+    return Handle;
+  }
+
+  UMaterialInterface *Material =
+      Params.Frame != INDEX_NONE
+          ? GetFrameMaterial(Params.Material, Params.FrameParamName,
+                             Params.Frame)
+          : Params.Material;
+
+  if (Decal->GetDecalMaterial() != Material) {
+    Decal->SetDecalMaterial(Material);
+  }
+  if (!Decal->DecalSize.Equals(Params.Extent)) {
+    Decal->DecalSize = Params.Extent;
+    Decal->MarkRenderStateDirty();
+  }
+  Decal->SetFadeScreenSize(Params.FadeScreenSize);
+  Decal->SetWorldLocationAndRotation(Params.Location, Params.Rotation);
+  Decal->SetVisibility(true);
+
+  ExpireTimes[Slot] = GetWorld()->GetTimeSeconds() +
+                      FMath::Max(Params.LifeSpan, UE_KINDA_SMALL_NUMBER);
+  ++NumActive;
+
+  Handle.Slot = Slot;
+  Handle.Serial = ++Serials[Slot];
+  return Handle;
+}
+
+void UPRFoleyDecalPoolSubsystem::ReleaseDecal(
+    const FPRFoleyDecalHandle &Handle) {
+  if (!Serials.IsValidIndex(Handle.Slot) ||
+      Serials[Handle.Slot] != Handle.Serial) {
+    return;
+  }
+  DeactivateSlot(Handle.Slot);
+}
+
+UMaterialInterface *
+UPRFoleyDecalPoolSubsystem::GetFrameMaterial(UMaterialInterface *Material,
+                                             FName ParamName, int32 Frame) {
+  const TTuple<TObjectKey<UMaterialInterface>, FName, int32> Key(
+      Material, ParamName, Frame);
+  if (const int32 *Index = FrameMIDIndices.Find(Key)) {
+    if (UMaterialInstanceDynamic *MID = FrameMIDs[*Index]) {
+      return MID;
+    }
+  }
+
+  UMaterialInstanceDynamic *MID =
+      UMaterialInstanceDynamic::Create(Material, this);
+  if (!MID) {
+    return Material;
+  }
+  MID->SetScalarParameterValue(ParamName, static_cast<float>(Frame));
+  FrameMIDIndices.Add(Key, FrameMIDs.Add(MID));
+  return MID;
+}
@@ -0,0 +1,238 @@
+#include "Subsystems/PRFoleyDistanceSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "PRFoleyComponent.h"
+#include "PRFoleySettings.h"
+#include "PRFoleyStats.h"
+
+namespace PRFoleyDistance {
+/** Below this many entries the pass runs inline on the game thread. */
+constexpr int32 MinBatchSize = 64;
+
+/** Steps emitted per entry per frame; further whole strides are skipped. */
+constexpr int32 MaxStepsPerTick = 8;
+} // namespace PRFoleyDistance
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleyDistanceSubsystem::Deinitialize() {
+  Components.Empty();
+  LastLocations.Empty();
+  CurrentLocations.Empty();
+  AccumulatedDistances.Empty();
+  StrideIntervals.Empty();
+  FootIndices.Empty();
+  NumFootSockets.Empty();
+  ActiveFlags.Empty();
+  StepCounts.Empty();
+  FirstStepDistances.Empty();
+  FrameDistances.Empty();
+  FrameDeltas.Empty();
+  IndexByComponent.Empty();
+  Super::Deinitialize();
+}
+
+bool UPRFoleyDistanceSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UPRFoleyDistanceSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UPRFoleyDistanceSubsystem, STATGROUP_PRFoley);
+}
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+void UPRFoleyDistanceSubsystem::RegisterComponent(
+    UPRFoleyComponent *Component) {
+  if (!Component || !Component->FootstepData || !Component->GetOwner()) {
+    return;
+  }
+
+  const UPRFootstepData *Data = Component->FootstepData;
+  int32 Index = INDEX_NONE;
+
+  if (const int32 *Found = IndexByComponent.Find(Component)) {
+    Index = *Found;
+  } else {
+    Index = Components.Add(Component);
+    LastLocations.Add(Component->GetOwner()->GetActorLocation());
+    CurrentLocations.AddZeroed();
+    AccumulatedDistances.Add(0.0);
+    StrideIntervals.AddZeroed();
+    FootIndices.Add(0);
+    NumFootSockets.AddZeroed();
+    ActiveFlags.AddZeroed();
+    StepCounts.AddZeroed();
+    FirstStepDistances.AddZeroed();
+    FrameDistances.AddZeroed();
+    FrameDeltas.AddZeroed();
+    IndexByComponent.Add(Component, Index);
+  }
+
+  StrideIntervals[Index] = Component->GetFootIntervalDistance();
+  NumFootSockets[Index] = Data->FootSockets.Num();
+  if (NumFootSockets[Index] > 0) {
+    FootIndices[Index] %= NumFootSockets[Index];
+  }
+}
+
+void UPRFoleyDistanceSubsystem::UnregisterComponent(
+    UPRFoleyComponent *Component) {
+  int32 Index = INDEX_NONE;
+  if (IndexByComponent.RemoveAndCopyValue(Component, Index)) {
+    RemoveAtSwap(Index);
+  }
+}
+
+void UPRFoleyDistanceSubsystem::RemoveAtSwap(int32 Index) {
+  const int32 LastIndex = Components.Num() - 1;
+  if (Index != LastIndex) {
+    // The last entry moves into the hole; fix its lookup first, stale or not,
+    // so a later purge or unregister finds it at its new index.
+    IndexByComponent.Add(Components[LastIndex], Index);
+  }
+
+  Components.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  LastLocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  CurrentLocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  AccumulatedDistances.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  StrideIntervals.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  FootIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  NumFootSockets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  ActiveFlags.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  StepCounts.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  FirstStepDistances.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  FrameDistances.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+  FrameDeltas.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// ============================================================================
+// Tick
+// ============================================================================
+
+void UPRFoleyDistanceSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+  TRACE_CPUPROFILER_EVENT_SCOPE(UPRFoleyDistanceSubsystem_Tick);
+
+  // ---- 1. Gather (game thread): owner locations, stale entries ----
+  for (int32 Index = Components.Num() - 1; Index >= 0; --Index) {
+    const UPRFoleyComponent *Component = Components[Index].ResolveObjectPtr();
+    const AActor *Owner = Component ? Component->GetOwner() : nullptr;
+    if (!Owner) {
+      // Destroyed without EndPlay (e.g. world teardown)
+      IndexByComponent.Remove(Components[Index]);
+      RemoveAtSwap(Index);
+      continue;
+    }
+
+    CurrentLocations[Index] = Owner->GetActorLocation();
+    // Culled entries only follow their owner (significance pass), unless
+    // the server still reports their AI noise
+    ActiveFlags[Index] =
+        (Component->bEnableFootstepLayer || Component->bEnableVoiceLayer) &&
+        Component->ShouldDetectEvents();
+  }
+
+  const int32 Num = Components.Num();
+  if (Num == 0) {
+    return;
+  }
+
+  // ---- 2. Accumulate (worker threads) ----
+  const double TeleportDistanceSq =
+      FMath::Square(GetDefault<UPRFoleySettings>()->TeleportDistance);
+  ParallelFor(
+      TEXT("PRFoleyDistance"), Num, PRFoleyDistance::MinBatchSize,
+      [this, TeleportDistanceSq](int32 Index) {
+        StepCounts[Index] = 0;
+
+        const FVector Current = CurrentLocations[Index];
+        const FVector Last = LastLocations[Index];
+        LastLocations[Index] = Current;
+
+        if (!ActiveFlags[Index]) {
+          return;
+        }
+
+        const double DistSq = FVector::DistSquared(Current, Last);
+        if (TeleportDistanceSq > 0.0 && DistSq > TeleportDistanceSq) {
+          // Teleport: no steps along the jump, start a fresh stride
+          AccumulatedDistances[Index] = 0.0;
+          return;
+        }
+
+        const double Before = AccumulatedDistances[Index];
+        const double Dist = FMath::Sqrt(DistSq);
+        if (Dist > 0.1) {
+          AccumulatedDistances[Index] += Dist;
+        }
+
+        const float Interval = StrideIntervals[Index];
+        if (Interval <= 0.0f || AccumulatedDistances[Index] < Interval) {
+          return;
+        }
+
+        const int32 Strides =
+            FMath::FloorToInt32(AccumulatedDistances[Index] / Interval);
+        AccumulatedDistances[Index] -= Strides * static_cast<double>(Interval);
+        const int32 Count =
+            FMath::Min(Strides, PRFoleyDistance::MaxStepsPerTick);
+
+        if (NumFootSockets[Index] > 0) {
+          FootIndices[Index] =
+              (FootIndices[Index] + Count) % NumFootSockets[Index];
+        }
+        StepCounts[Index] = static_cast<uint8>(Count);
+        FirstStepDistances[Index] =
+            FMath::Max(static_cast<float>(Interval - Before), 0.0f);
+        FrameDistances[Index] = static_cast<float>(Dist);
+        FrameDeltas[Index] = Current - Last;
+      });
+
+  // ---- 3. Dispatch (game thread): only entries that stepped ----
+  // Copied out first: a step may end play on an actor and unregister it.
+  struct FStep {
+    TObjectKey<UPRFoleyComponent> Component;
+    int32 FootIndex = INDEX_NONE;
+    FVector Offset = FVector::ZeroVector;
+    float StartDelay = 0.0f;
+  };
+  TArray<FStep, TInlineAllocator<32>> Steps;
+  for (int32 Index = 0; Index < Num; ++Index) {
+    const int32 Count = StepCounts[Index];
+    const int32 NumSockets = NumFootSockets[Index];
+    for (int32 Step = 0; Step < Count; ++Step) {
+      // Where along this frame's path the stride was crossed: the step is
+      // placed there and started that far into the next frame
+      const float Distance =
+          FirstStepDistances[Index] + Step * StrideIntervals[Index];
+      const float Alpha =
+          FrameDistances[Index] > 0.0f
+              ? FMath::Clamp(Distance / FrameDistances[Index], 0.0f, 1.0f)
+              : 1.0f;
+
+      FStep &Out = Steps.AddDefaulted_GetRef();
+      Out.Component = Components[Index];
+      Out.FootIndex =
+          NumSockets > 0
+              ? (FootIndices[Index] - (Count - 1 - Step) + NumSockets * Count) %
+                    NumSockets
+              : INDEX_NONE;
+      Out.Offset = -(1.0f - Alpha) * FrameDeltas[Index];
+      Out.StartDelay = Alpha * DeltaTime;
+    }
+  }
+
+  for (const FStep &Step : Steps) {
+    if (UPRFoleyComponent *Component = Step.Component.ResolveObjectPtr()) {
+      Component->TriggerDistanceFootstep(Step.FootIndex, Step.Offset,
+                                         Step.StartDelay);
+    }
+  }
+}
@@ -0,0 +1,182 @@
+#include "Subsystems/PRFoleyFootprintSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+#include "PRFoleySettings.h"
+#include "PRFoleyStats.h"
+
+namespace {
+/** Expired instances stay allocated but collapse to nothing. */
+const FTransform HiddenInstanceTransform(FQuat::Identity, FVector::ZeroVector,
+                                         FVector::ZeroVector);
+} // namespace
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleyFootprintSubsystem::Deinitialize() {
+  if (IsValid(HostActor)) {
+    HostActor->Destroy();
+  }
+  HostActor = nullptr;
+  Batches.Empty();
+  BatchIndices.Empty();
+  NumActive = 0;
+  Super::Deinitialize();
+}
+
+bool UPRFoleyFootprintSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UPRFoleyFootprintSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UPRFoleyFootprintSubsystem,
+                                  STATGROUP_PRFoley);
+}
+
+// ============================================================================
+// Expiry
+// ============================================================================
+
+void UPRFoleyFootprintSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+  TRACE_CPUPROFILER_EVENT_SCOPE(UPRFoleyFootprintSubsystem_Tick);
+
+  const UWorld *World = GetWorld();
+  if (!World) {
+    return;
+  }
+
+  const double Now = World->GetTimeSeconds();
+  for (FPRFootprintBatch &Batch : Batches) {
+    if (Batch.NumActive == 0 || !Batch.Component) {
+      continue;
+    }
+
+    bool bDirty = false;
+    for (int32 Index = 0; Index < Batch.ExpireTimes.Num(); ++Index) {
+      if (Batch.ExpireTimes[Index] > 0.0 && Batch.ExpireTimes[Index] <= Now) {
+        Batch.ExpireTimes[Index] = 0.0;
+        --Batch.NumActive;
+        --NumActive;
+        Batch.Component->UpdateInstanceTransform(
+            Index, HiddenInstanceTransform, true, false, true);
+        bDirty = true;
+      }
+    }
+
+    // One render state update per batch instead of one per instance
+    if (bDirty) {
+      Batch.Component->MarkRenderStateDirty();
+    }
+  }
+
+  CSV_CUSTOM_STAT(PRFoley, FootprintInstancesAlive, NumActive,
+                  ECsvCustomStatOp::Set);
+}
+
+// ============================================================================
+// Spawning
+// ============================================================================
+
+FPRFootprintBatch *
+UPRFoleyFootprintSubsystem::FindOrAddBatch(UStaticMesh *Mesh,
+                                           UMaterialInterface *Material) {
+  const TPair<TObjectKey<UStaticMesh>, TObjectKey<UMaterialInterface>> Key(
+      Mesh, Material);
+  if (const int32 *Index = BatchIndices.Find(Key)) {
+    if (Batches[*Index].Component) {
+      return &Batches[*Index];
+    }
+  }
+
+  UWorld *World = GetWorld();
+  if (!World) {
+    return nullptr;
+  }
+
+  if (!IsValid(HostActor)) {
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Name = MakeUniqueObjectName(World->PersistentLevel,
+                                            AActor::StaticClass(),
+                                            TEXT("PRFoleyFootprints"));
+    SpawnParams.ObjectFlags |= RF_Transient;
+    HostActor = World->SpawnActor<AActor>(AActor::StaticClass(),
+                                          FTransform::Identity, SpawnParams);
+    if (!HostActor) {
+      return nullptr;
+    }
+  }
+
+  UInstancedStaticMeshComponent *ISM =
+      NewObject<UInstancedStaticMeshComponent>(HostActor);
+  ISM->SetMobility(EComponentMobility::Movable);
+  ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+  ISM->SetCastShadow(false);
+  ISM->SetCanEverAffectNavigation(false);
+  ISM->SetStaticMesh(Mesh);
+  ISM->SetMaterial(0, Material);
+  ISM->NumCustomDataFloats = NumCustomDataFloats;
+  if (!HostActor->GetRootComponent()) {
+    HostActor->SetRootComponent(ISM);
+  }
+  ISM->RegisterComponent();
+  HostActor->AddInstanceComponent(ISM);
+
+  FPRFootprintBatch Batch;
+  Batch.Component = ISM;
+  const int32 NewIndex = Batches.Add(MoveTemp(Batch));
+  BatchIndices.Add(Key, NewIndex);
+  return &Batches[NewIndex];
+}
+
+bool UPRFoleyFootprintSubsystem::AddFootprint(UStaticMesh *Mesh,
+                                              UMaterialInterface *Material,
+                                              const FTransform &Transform,
+                                              int32 Frame, float LifeSpan) {
+  if (!Mesh || !Material) {
+    return false;
+  }
+
+  FPRFootprintBatch *Batch = FindOrAddBatch(Mesh, Material);
+  if (!Batch) {
+    return false;
+  }
+
+  const double Now = GetWorld()->GetTimeSeconds();
+  const float CustomData[NumCustomDataFloats] = {
+      static_cast<float>(FMath::Max(Frame, 0)), static_cast<float>(Now),
+      LifeSpan};
+
+  // Grow up to capacity; past that reuse the oldest instance in ring order.
+  const int32 Capacity = FMath::Max(
+      1, GetDefault<UPRFoleySettings>()->MaxFootprintInstancesPerMaterial);
+  int32 Instance;
+  if (Batch->ExpireTimes.Num() < Capacity) {
+    Instance = Batch->Component->AddInstance(Transform, true);
+    Batch->ExpireTimes.Add(0.0);
+  } else {
+    Instance = Batch->NextInstance % Batch->ExpireTimes.Num();
+    Batch->NextInstance = (Instance + 1) % Batch->ExpireTimes.Num();
+    Batch->Component->UpdateInstanceTransform(Instance, Transform, true, false,
+                                              true);
+  }
+
+  if (!Batch->ExpireTimes.IsValidIndex(Instance)) {
+    return false;
+  }
+
+  Batch->Component->SetCustomData(Instance, CustomData, true);
+
+  if (Batch->ExpireTimes[Instance] <= 0.0) {
+    ++Batch->NumActive;
+    ++NumActive;
+  }
+  Batch->ExpireTimes[Instance] =
+      Now + FMath::Max(LifeSpan, UE_KINDA_SMALL_NUMBER);
+  return true;
+}
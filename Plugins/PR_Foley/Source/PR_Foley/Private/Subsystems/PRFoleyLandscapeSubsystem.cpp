@@ -0,0 +1,482 @@
+#include "Subsystems/PRFoleyLandscapeSubsystem.h"
+#include "Engine/Level.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "LandscapeComponent.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
+#include "LandscapeLayerInfoObject.h"
+#include "LandscapeProxy.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "PRAudioLog.h"
+#include "PRFoleyStats.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_CYCLE_STAT(TEXT("Landscape Decode"), STAT_PRFoley_LandscapeDecode,
+                   STATGROUP_PRFoley);
+DECLARE_CYCLE_STAT(TEXT("Landscape Sample"), STAT_PRFoley_LandscapeSample,
+                   STATGROUP_PRFoley);
+
+namespace {
+uint8 GetChannel(const FColor &Texel, int32 Channel) {
+  switch (Channel) {
+  case 0:
+    return Texel.R;
+  case 1:
+    return Texel.G;
+  case 2:
+    return Texel.B;
+  default:
+    return Texel.A;
+  }
+}
+} // namespace
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleyLandscapeSubsystem::Initialize(
+    FSubsystemCollectionBase &Collection) {
+  Super::Initialize(Collection);
+  LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(
+      this, &UPRFoleyLandscapeSubsystem::OnLevelAdded);
+  LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(
+      this, &UPRFoleyLandscapeSubsystem::OnLevelRemoved);
+}
+
+void UPRFoleyLandscapeSubsystem::Deinitialize() {
+  FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+  FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+  Components.Empty();
+  BakedWeights.Empty();
+  DecodedBytes = 0;
+  NumFailedComponents = 0;
+  Super::Deinitialize();
+}
+
+void UPRFoleyLandscapeSubsystem::OnWorldBeginPlay(UWorld &InWorld) {
+  Super::OnWorldBeginPlay(InWorld);
+
+  const FString MapName =
+      UWorld::RemovePIEPrefix(InWorld.GetPackage()->GetName());
+  LoadBakedWeights(GetBakedWeightsFilename(MapName));
+
+  for (ULevel *Level : InWorld.GetLevels()) {
+    DecodeLevel(Level);
+  }
+  UE_LOG(LogPRAudio, Verbose,
+         TEXT("[PRFoley] Decoded %d landscape components (%lld KB), %d "
+              "baked"),
+         Components.Num(), DecodedBytes / 1024, BakedWeights.Num());
+  if (NumFailedComponents > 0) {
+    UE_LOG(LogPRAudio, Warning,
+           TEXT("[PRFoley] %d landscape components of %s have no CPU "
+                "weightmap data and no baked weights: footsteps trace there. "
+                "Run PRFoleyBakeSurfaceGrid to write %s."),
+           NumFailedComponents, *MapName,
+           *FPaths::GetCleanFilename(GetBakedWeightsFilename(MapName)));
+  }
+}
+
+void UPRFoleyLandscapeSubsystem::OnLevelAdded(ULevel *Level,
+                                              UWorld *InWorld) {
+  if (InWorld == GetWorld() && InWorld->HasBegunPlay()) {
+    DecodeLevel(Level);
+  }
+}
+
+void UPRFoleyLandscapeSubsystem::OnLevelRemoved(ULevel *Level,
+                                                UWorld *InWorld) {
+  if (InWorld != GetWorld()) {
+    return;
+  }
+  // A null level means every streaming level is being removed
+  const TObjectKey<ULevel> LevelKey(Level);
+  for (auto It = Components.CreateIterator(); It; ++It) {
+    if (!Level || It->Value.Level == LevelKey) {
+      DecodedBytes -= It->Value.Weights.GetAllocatedSize();
+      It.RemoveCurrent();
+    }
+  }
+}
+
+// ============================================================================
+// Decoding
+// ============================================================================
+
+void UPRFoleyLandscapeSubsystem::DecodeLevel(ULevel *Level) {
+  const UWorld *World = GetWorld();
+  if (!Level || !World || !World->IsGameWorld()) {
+    return;
+  }
+
+  FTexelCache TexelCache;
+  for (const AActor *Actor : Level->Actors) {
+    const ALandscapeProxy *Proxy = Cast<ALandscapeProxy>(Actor);
+    if (!Proxy) {
+      continue;
+    }
+    for (const ULandscapeComponent *Component : Proxy->LandscapeComponents) {
+      FindOrDecode(Component, TexelCache);
+    }
+  }
+}
+
+const UPRFoleyLandscapeSubsystem::FComponentWeights *
+UPRFoleyLandscapeSubsystem::FindOrDecode(const ULandscapeComponent *Component,
+                                         FTexelCache &TexelCache) {
+  if (!Component) {
+    return nullptr;
+  }
+
+  FComponentWeights *Weights = Components.Find(Component);
+  if (!Weights) {
+    // Failed decodes are kept (empty) so they are not retried every step
+    Weights = &Components.Add(Component);
+    Weights->Level = Component->GetComponentLevel();
+    if (DecodeComponent(*Component, TexelCache, *Weights)) {
+      DecodedBytes += Weights->Weights.GetAllocatedSize();
+    } else {
+      Weights->Surfaces.Empty();
+      Weights->Weights.Empty();
+      if (!BakedWeights.Contains(MakeBakedKey(*Component))) {
+        ++NumFailedComponents;
+        UE_LOG(LogPRAudio, Verbose,
+               TEXT("[PRFoley] No landscape weights for %s"),
+               *Component->GetPathName());
+      }
+    }
+  }
+  if (Weights->Surfaces.Num() > 0) {
+    return Weights;
+  }
+  // Cooked: the weightmap mip has no CPU copy, use the baked weights
+  return BakedWeights.IsEmpty() ? nullptr
+                                : BakedWeights.Find(MakeBakedKey(*Component));
+}
+
+const UPRFoleyLandscapeSubsystem::FWeightmapTexels *
+UPRFoleyLandscapeSubsystem::ReadWeightmap(const UTexture2D *Texture,
+                                          FTexelCache &TexelCache) {
+  if (!Texture) {
+    return nullptr;
+  }
+  if (const FWeightmapTexels *Cached = TexelCache.Find(Texture)) {
+    return Cached->Texels.Num() > 0 ? Cached : nullptr;
+  }
+
+  FWeightmapTexels &Out = TexelCache.Add(Texture);
+
+#if WITH_EDITORONLY_DATA
+  if (Texture->Source.IsValid() &&
+      Texture->Source.GetFormat() == TSF_BGRA8) {
+    TArray64<uint8> MipData;
+    if (Texture->Source.GetMipData(MipData, 0, 0, 0)) {
+      Out.SizeX = Texture->Source.GetSizeX();
+      Out.SizeY = Texture->Source.GetSizeY();
+      Out.Texels.SetNumUninitialized(Out.SizeX * Out.SizeY);
+      FMemory::Memcpy(Out.Texels.GetData(), MipData.GetData(),
+                      Out.Texels.Num() * sizeof(FColor));
+      return &Out;
+    }
+  }
+#endif
+
+  // Cooked: only possible while the top mip's bulk data is still resident
+  const FTexturePlatformData *PlatformData =
+      const_cast<UTexture2D *>(Texture)->GetPlatformData();
+  if (!PlatformData || PlatformData->PixelFormat != PF_B8G8R8A8 ||
+      PlatformData->Mips.Num() == 0) {
+    return nullptr;
+  }
+  const FTexture2DMipMap &Mip = PlatformData->Mips[0];
+  if (!Mip.BulkData.IsBulkDataLoaded()) {
+    return nullptr;
+  }
+
+  Out.SizeX = Mip.SizeX;
+  Out.SizeY = Mip.SizeY;
+  Out.Texels.SetNumUninitialized(Out.SizeX * Out.SizeY);
+  FByteBulkData &BulkData = const_cast<FByteBulkData &>(Mip.BulkData);
+  FMemory::Memcpy(Out.Texels.GetData(), BulkData.LockReadOnly(),
+                  Out.Texels.Num() * sizeof(FColor));
+  BulkData.Unlock();
+  return &Out;
+}
+
+bool UPRFoleyLandscapeSubsystem::DecodeComponent(
+    const ULandscapeComponent &Component, FTexelCache &TexelCache,
+    FComponentWeights &Out) {
+  SCOPE_CYCLE_COUNTER(STAT_PRFoley_LandscapeDecode);
+  TRACE_CPUPROFILER_EVENT_SCOPE(PRFoley_LandscapeDecode);
+
+  const TArray<FWeightmapLayerAllocationInfo> &Allocations =
+      Component.GetWeightmapLayerAllocations();
+  const TArray<TObjectPtr<UTexture2D>> &Textures =
+      Component.GetWeightmapTextures();
+  if (Allocations.Num() == 0) {
+    return false;
+  }
+
+  const ALandscapeProxy *Proxy = Component.GetLandscapeProxy();
+  const EPhysicalSurface DefaultSurface =
+      Proxy && Proxy->DefaultPhysMaterial
+          ? Proxy->DefaultPhysMaterial->SurfaceType.GetValue()
+          : SurfaceType_Default;
+
+  // Layers sharing a physical material are merged into one weight
+  struct FLayerSource {
+    const FWeightmapTexels *Texels;
+    int32 Channel;
+    int32 Surface;
+  };
+  TArray<FLayerSource, TInlineAllocator<8>> Layers;
+  for (const FWeightmapLayerAllocationInfo &Alloc : Allocations) {
+    if (!Alloc.LayerInfo ||
+        Alloc.LayerInfo == ALandscapeProxy::VisibilityLayer ||
+        !Textures.IsValidIndex(Alloc.WeightmapTextureIndex)) {
+      continue;
+    }
+    const FWeightmapTexels *Texels =
+        ReadWeightmap(Textures[Alloc.WeightmapTextureIndex], TexelCache);
+    if (!Texels) {
+      return false;
+    }
+    const UPhysicalMaterial *PhysMat = Alloc.LayerInfo->GetPhysicalMaterial();
+    const EPhysicalSurface Surface =
+        PhysMat ? PhysMat->SurfaceType.GetValue() : DefaultSurface;
+    Layers.Add({Texels, Alloc.WeightmapTextureChannel,
+                Out.Surfaces.AddUnique(Surface)});
+  }
+  if (Layers.Num() == 0) {
+    return false;
+  }
+
+  // Weightmap texels duplicate the vertices shared by adjacent subsections
+  const int32 SizeQuads = Component.ComponentSizeQuads;
+  const int32 SubsectionQuads = Component.SubsectionSizeQuads;
+  const int32 NumSubsections = Component.NumSubsections;
+  const int32 NumSurfaces = Out.Surfaces.Num();
+  Out.SizeVerts = SizeQuads + 1;
+  Out.Weights.SetNumZeroed(Out.SizeVerts * Out.SizeVerts * NumSurfaces);
+
+  for (const FLayerSource &Layer : Layers) {
+    const int32 OffsetX = FMath::RoundToInt(Component.WeightmapScaleBias.Z *
+                                            Layer.Texels->SizeX);
+    const int32 OffsetY = FMath::RoundToInt(Component.WeightmapScaleBias.W *
+                                            Layer.Texels->SizeY);
+    for (int32 Y = 0; Y < Out.SizeVerts; ++Y) {
+      const int32 SubY = FMath::Min(Y / SubsectionQuads, NumSubsections - 1);
+      const int32 TexY = OffsetY + Y + SubY;
+      for (int32 X = 0; X < Out.SizeVerts; ++X) {
+        const int32 SubX =
+            FMath::Min(X / SubsectionQuads, NumSubsections - 1);
+        const int32 TexX = OffsetX + X + SubX;
+        if (TexX >= Layer.Texels->SizeX || TexY >= Layer.Texels->SizeY) {
+          return false;
+        }
+        const FColor &Texel =
+            Layer.Texels->Texels[TexY * Layer.Texels->SizeX + TexX];
+        uint8 &Weight =
+            Out.Weights[(Y * Out.SizeVerts + X) * NumSurfaces + Layer.Surface];
+        Weight = static_cast<uint8>(
+            FMath::Min(255, Weight + GetChannel(Texel, Layer.Channel)));
+      }
+    }
+  }
+
+  Out.Weights.Shrink();
+  return true;
+}
+
+// ============================================================================
+// Baked Weights
+// ============================================================================
+
+FString UPRFoleyLandscapeSubsystem::GetBakedWeightsFilename(
+    const FString &MapPackageName) {
+  return FPackageName::LongPackageNameToFilename(MapPackageName,
+                                                 TEXT(".pfland"));
+}
+
+UPRFoleyLandscapeSubsystem::FBakedKey
+UPRFoleyLandscapeSubsystem::MakeBakedKey(const ULandscapeComponent &Component) {
+  const ALandscapeProxy *Proxy = Component.GetLandscapeProxy();
+  return FBakedKey(Proxy ? Proxy->GetLandscapeGuid() : FGuid(),
+                   Component.GetSectionBase());
+}
+
+void UPRFoleyLandscapeSubsystem::SerializeWeights(FArchive &Ar,
+                                                  FComponentWeights &Weights) {
+  int32 NumSurfaces = Weights.Surfaces.Num();
+  Ar << NumSurfaces;
+  if (Ar.IsLoading()) {
+    Weights.Surfaces.SetNum(FMath::Clamp(NumSurfaces, 0, SurfaceType_Max));
+  }
+  for (EPhysicalSurface &Surface : Weights.Surfaces) {
+    uint8 Value = static_cast<uint8>(Surface);
+    Ar << Value;
+    Surface = static_cast<EPhysicalSurface>(Value);
+  }
+  Ar << Weights.SizeVerts;
+  Ar << Weights.Weights;
+}
+
+bool UPRFoleyLandscapeSubsystem::LoadBakedWeights(const FString &Filename) {
+  TArray<uint8> Data;
+  if (!FPaths::FileExists(Filename) ||
+      !FFileHelper::LoadFileToArray(Data, *Filename)) {
+    return false;
+  }
+
+  FMemoryReader Reader(Data);
+  uint32 Magic = 0;
+  uint32 Version = 0;
+  int32 NumComponents = 0;
+  Reader << Magic << Version << NumComponents;
+  if (Magic != BakedFileMagic || Version != BakedFileVersion ||
+      NumComponents < 0) {
+    UE_LOG(LogPRAudio, Warning,
+           TEXT("[PRFoley] Invalid or outdated landscape weights: %s"),
+           *Filename);
+    return false;
+  }
+
+  BakedWeights.Reserve(NumComponents);
+  for (int32 Index = 0; Index < NumComponents && !Reader.IsError(); ++Index) {
+    FBakedKey Key;
+    Reader << Key.Key << Key.Value;
+    FComponentWeights Weights;
+    SerializeWeights(Reader, Weights);
+
+    const int64 Expected = static_cast<int64>(Weights.SizeVerts) *
+                           Weights.SizeVerts * Weights.Surfaces.Num();
+    if (Reader.IsError() || Weights.SizeVerts < 2 ||
+        Weights.Surfaces.Num() == 0 || Weights.Weights.Num() != Expected) {
+      break;
+    }
+    DecodedBytes += Weights.Weights.GetAllocatedSize();
+    BakedWeights.Add(Key, MoveTemp(Weights));
+  }
+
+  if (Reader.IsError() || BakedWeights.Num() != NumComponents) {
+    UE_LOG(LogPRAudio, Warning,
+           TEXT("[PRFoley] Truncated landscape weights: %s"), *Filename);
+  }
+  return BakedWeights.Num() > 0;
+}
+
+#if WITH_EDITOR
+int32 UPRFoleyLandscapeSubsystem::SaveBakedWeights(UWorld &World,
+                                                   const FString &Filename) {
+  TArray<uint8> Data;
+  FMemoryWriter Writer(Data);
+  uint32 Magic = BakedFileMagic;
+  uint32 Version = BakedFileVersion;
+  int32 NumComponents = 0;
+  Writer << Magic << Version << NumComponents;
+
+  FTexelCache TexelCache;
+  for (TActorIterator<ALandscapeProxy> It(&World); It; ++It) {
+    for (const ULandscapeComponent *Component : It->LandscapeComponents) {
+      FComponentWeights Weights;
+      if (!Component || !DecodeComponent(*Component, TexelCache, Weights)) {
+        continue;
+      }
+      FBakedKey Key = MakeBakedKey(*Component);
+      Writer << Key.Key << Key.Value;
+      SerializeWeights(Writer, Weights);
+      ++NumComponents;
+    }
+  }
+  if (NumComponents == 0) {
+    return 0;
+  }
+
+  // Patch the count now that it is known
+  Writer.Seek(sizeof(Magic) + sizeof(Version));
+  Writer << NumComponents;
+  return FFileHelper::SaveArrayToFile(Data, *Filename) ? NumComponents
+                                                       : INDEX_NONE;
+}
+#endif
+
+// ============================================================================
+// Sampling
+// ============================================================================
+
+bool UPRFoleyLandscapeSubsystem::SampleSurfaces(
+    const FHitResult &Hit, FPRLandscapeSurfaceSample &Out) {
+  SCOPE_CYCLE_COUNTER(STAT_PRFoley_LandscapeSample);
+
+  const UPrimitiveComponent *HitComponent = Hit.GetComponent();
+  const ULandscapeComponent *Component =
+      Cast<ULandscapeComponent>(HitComponent);
+  if (const ULandscapeHeightfieldCollisionComponent *Collision =
+          Cast<ULandscapeHeightfieldCollisionComponent>(HitComponent)) {
+    Component = Collision->GetRenderComponent();
+  }
+
+  FTexelCache TexelCache;
+  const FComponentWeights *Weights = FindOrDecode(Component, TexelCache);
+  if (!Weights) {
+    return false;
+  }
+
+  // Component space is in quads, origin at the first vertex
+  const FVector Local =
+      Component->GetComponentTransform().InverseTransformPosition(
+          Hit.ImpactPoint);
+  const int32 MaxVert = Weights->SizeVerts - 1;
+  const float X = FMath::Clamp(static_cast<float>(Local.X), 0.0f,
+                               static_cast<float>(MaxVert));
+  const float Y = FMath::Clamp(static_cast<float>(Local.Y), 0.0f,
+                               static_cast<float>(MaxVert));
+  const int32 X0 = FMath::Min(FMath::FloorToInt(X), MaxVert - 1);
+  const int32 Y0 = FMath::Min(FMath::FloorToInt(Y), MaxVert - 1);
+  const float FracX = X - X0;
+  const float FracY = Y - Y0;
+
+  const int32 NumSurfaces = Weights->Surfaces.Num();
+  const uint8 *Row0 =
+      &Weights->Weights[(Y0 * Weights->SizeVerts + X0) * NumSurfaces];
+  const uint8 *Row1 = Row0 + Weights->SizeVerts * NumSurfaces;
+
+  int32 Best = INDEX_NONE;
+  int32 Second = INDEX_NONE;
+  float BestWeight = 0.0f;
+  float SecondWeight = 0.0f;
+  float TotalWeight = 0.0f;
+  for (int32 Layer = 0; Layer < NumSurfaces; ++Layer) {
+    const float Top = FMath::Lerp<float>(Row0[Layer],
+                                         Row0[NumSurfaces + Layer], FracX);
+    const float Bottom = FMath::Lerp<float>(Row1[Layer],
+                                            Row1[NumSurfaces + Layer], FracX);
+    const float Weight = FMath::Lerp(Top, Bottom, FracY);
+    TotalWeight += Weight;
+    if (Weight > BestWeight) {
+      Second = Best;
+      SecondWeight = BestWeight;
+      Best = Layer;
+      BestWeight = Weight;
+    } else if (Weight > SecondWeight) {
+      Second = Layer;
+      SecondWeight = Weight;
+    }
+  }
+
+  if (Best == INDEX_NONE) {
+    return false;
+  }
+
+  Out.PrimarySurface = Weights->Surfaces[Best];
+  Out.PrimaryWeight = BestWeight / TotalWeight;
+  Out.SecondarySurface =
+      Second != INDEX_NONE ? Weights->Surfaces[Second] : SurfaceType_Default;
+  Out.SecondaryWeight = SecondWeight / TotalWeight;
+  return true;
+}
@@ -0,0 +1,143 @@
+#include "Subsystems/PRFoleyNetRelaySubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "PRFoleyComponent.h"
+#include "PRFoleyNetRelayComponent.h"
+#include "PRFoleyStats.h"
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleyNetRelaySubsystem::Deinitialize() {
+  RemoteViews.Empty();
+  LocalViews.Empty();
+  Relays.Empty();
+  Super::Deinitialize();
+}
+
+bool UPRFoleyNetRelaySubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================================================
+// Routing
+// ============================================================================
+
+void UPRFoleyNetRelaySubsystem::RouteEvents(
+    UPRFoleyComponent &Source, const FPRFoleyNetEventBatch &Batch,
+    float Range) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UPRFoleyNetRelaySubsystem_RouteEvents);
+
+  AActor *Owner = Source.GetOwner();
+  if (!Owner) {
+    return;
+  }
+
+  if (ViewsFrame != GFrameCounter) {
+    UpdateViews();
+  }
+
+  const UNetConnection *OwnerConnection = Owner->GetNetConnection();
+  const float RangeSq = FMath::Square(Range);
+
+  FPRFoleyNetEventBatch Filtered;
+  Filtered.Origin = Batch.Origin;
+  Filtered.Events.Reserve(Batch.Events.Num());
+
+  for (const FRemoteView &View : RemoteViews) {
+    UPRFoleyNetRelayComponent *Relay = View.Relay.Get();
+    if (!Relay ||
+        (OwnerConnection && View.Connection.Get() == OwnerConnection)) {
+      continue;
+    }
+
+    Filtered.Events.Reset();
+    for (const FPRFoleyNetEvent &Event : Batch.Events) {
+      if (FVector::DistSquared(Event.Location, View.Location) <= RangeSq) {
+        Filtered.Events.Add(Event);
+      }
+    }
+    if (Filtered.Events.Num() > 0) {
+      // A relay added this frame is not on the client yet: the first batch
+      // may be dropped, like any unreliable cosmetic RPC
+      Relay->Client_FoleyEvents(&Source, Filtered);
+      PRFOLEY_COUNT(RPCsSent, 1);
+    }
+  }
+
+  if (LocalViews.Num() == 0) {
+    return;
+  }
+
+  // Every local view shares the same source component: play each event
+  // once if any of them is in range
+  Filtered.Events.Reset();
+  for (const FPRFoleyNetEvent &Event : Batch.Events) {
+    for (const FVector &ViewLocation : LocalViews) {
+      if (FVector::DistSquared(Event.Location, ViewLocation) <= RangeSq) {
+        Filtered.Events.Add(Event);
+        break;
+      }
+    }
+  }
+  if (Filtered.Events.Num() > 0) {
+    Source.ReceiveFoleyEvents(Filtered);
+  }
+}
+
+void UPRFoleyNetRelaySubsystem::UpdateViews() {
+  ViewsFrame = GFrameCounter;
+  RemoteViews.Reset();
+  LocalViews.Reset();
+
+  UWorld *World = GetWorld();
+  if (!World) {
+    return;
+  }
+
+  for (FConstPlayerControllerIterator It =
+           World->GetPlayerControllerIterator();
+       It; ++It) {
+    APlayerController *PC = It->Get();
+    const AActor *ViewTarget = PC ? PC->GetViewTarget() : nullptr;
+    if (!ViewTarget) {
+      continue;
+    }
+
+    if (PC->IsLocalController()) {
+      LocalViews.Add(ViewTarget->GetActorLocation());
+      continue;
+    }
+
+    FRemoteView &View = RemoteViews.AddDefaulted_GetRef();
+    View.Location = ViewTarget->GetActorLocation();
+    View.Connection = PC->GetNetConnection();
+    View.Relay = FindOrAddRelay(*PC);
+  }
+
+  // Controllers that logged out take their relay with them
+  for (auto It = Relays.CreateIterator(); It; ++It) {
+    if (!It->Value.IsValid()) {
+      It.RemoveCurrent();
+    }
+  }
+}
+
+UPRFoleyNetRelayComponent *
+UPRFoleyNetRelaySubsystem::FindOrAddRelay(APlayerController &PC) {
+  TWeakObjectPtr<UPRFoleyNetRelayComponent> &Cached = Relays.FindOrAdd(&PC);
+  if (UPRFoleyNetRelayComponent *Relay = Cached.Get()) {
+    return Relay;
+  }
+
+  UPRFoleyNetRelayComponent *Relay =
+      PC.FindComponentByClass<UPRFoleyNetRelayComponent>();
+  if (!Relay) {
+    Relay = NewObject<UPRFoleyNetRelayComponent>(&PC, NAME_None, RF_Transient);
+    Relay->RegisterComponent();
+  }
+  Cached = Relay;
+  return Relay;
+}
@@ -0,0 +1,77 @@
+#include "Subsystems/PRFoleyNoiseSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "PRFoleySettings.h"
+#include "PRFoleyStats.h"
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleyNoiseSubsystem::Deinitialize() {
+  PendingNoises.Empty();
+  Super::Deinitialize();
+}
+
+bool UPRFoleyNoiseSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UPRFoleyNoiseSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UPRFoleyNoiseSubsystem, STATGROUP_PRFoley);
+}
+
+// ============================================================================
+// Reports
+// ============================================================================
+
+void UPRFoleyNoiseSubsystem::ReportNoise(AActor *Instigator,
+                                         const FVector &Location,
+                                         float Loudness, float MaxRange) {
+  if (!Instigator || Loudness <= 0.0f) {
+    return;
+  }
+
+  const float CellSize =
+      FMath::Max(GetDefault<UPRFoleySettings>()->NoiseCellSize, 1.0f);
+  const FIntVector Cell(FMath::FloorToInt(Location.X / CellSize),
+                        FMath::FloorToInt(Location.Y / CellSize),
+                        FMath::FloorToInt(Location.Z / CellSize));
+
+  FPendingNoise &Noise =
+      PendingNoises.FindOrAdd(FNoiseKey(Instigator, Cell));
+  Noise.Instigator = Instigator;
+  Noise.WeightedLocation += Location * Loudness;
+  Noise.TotalWeight += Loudness;
+  Noise.MaxRange = FMath::Max(Noise.MaxRange, MaxRange);
+  Noise.Loudness = FMath::Max(Noise.Loudness, Loudness);
+}
+
+// ============================================================================
+// Tick
+// ============================================================================
+
+void UPRFoleyNoiseSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+  TRACE_CPUPROFILER_EVENT_SCOPE(UPRFoleyNoiseSubsystem_Tick);
+
+  if (PendingNoises.Num() == 0) {
+    return;
+  }
+
+  const FName Tag = GetDefault<UPRFoleySettings>()->NoiseTag;
+  for (const TPair<FNoiseKey, FPendingNoise> &Pair : PendingNoises) {
+    const FPendingNoise &Noise = Pair.Value;
+    AActor *Instigator = Noise.Instigator.Get();
+    if (!Instigator || Noise.TotalWeight <= 0.0f) {
+      continue;
+    }
+
+    Instigator->MakeNoise(Noise.Loudness, Cast<APawn>(Instigator),
+                          Noise.WeightedLocation / Noise.TotalWeight,
+                          Noise.MaxRange, Tag);
+  }
+
+  PendingNoises.Reset();
+}
@@ -0,0 +1,231 @@
+#include "Subsystems/PRFoleySignificanceSubsystem.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "PRFoleyComponent.h"
+#include "PRFoleySettings.h"
+#include "PRFoleyStats.h"
+
+namespace PRFoleySignificance {
+/** Extra half-angle (degrees) so characters at the screen edge keep VFX. */
+constexpr float FOVMarginDegrees = 10.0f;
+
+/** Relevance bonus of a breather that already has a real voice. */
+constexpr float RealVoiceHysteresis = 1.25f;
+
+/** Returns the squared range of a layer, falling back to the audio range. */
+float LayerRangeSq(float LayerDistance, float AudioDistance) {
+  const float Range = LayerDistance > 0.0f ? LayerDistance : AudioDistance;
+  return Range > 0.0f ? FMath::Square(Range) : TNumericLimits<float>::Max();
+}
+} // namespace PRFoleySignificance
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleySignificanceSubsystem::Deinitialize() {
+  Components.Empty();
+  Breathers.Empty();
+  Listeners.Empty();
+  Super::Deinitialize();
+}
+
+bool UPRFoleySignificanceSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UPRFoleySignificanceSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UPRFoleySignificanceSubsystem,
+                                  STATGROUP_PRFoley);
+}
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+void UPRFoleySignificanceSubsystem::RegisterComponent(
+    UPRFoleyComponent *Component) {
+  if (Component) {
+    Components.AddUnique(Component);
+    // Evaluate now so the first event of a freshly spawned character is
+    // not judged by the default tier.
+    EvaluateComponent(*Component);
+  }
+}
+
+void UPRFoleySignificanceSubsystem::UnregisterComponent(
+    UPRFoleyComponent *Component) {
+  Components.RemoveSwap(Component, EAllowShrinking::No);
+}
+
+// ============================================================================
+// Tick
+// ============================================================================
+
+void UPRFoleySignificanceSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+  TRACE_CPUPROFILER_EVENT_SCOPE(UPRFoleySignificanceSubsystem_Tick);
+
+  GatherListeners();
+
+  for (int32 Index = Components.Num() - 1; Index >= 0; --Index) {
+    if (UPRFoleyComponent *Component = Components[Index].Get()) {
+      EvaluateComponent(*Component);
+    } else {
+      Components.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    }
+  }
+
+  AssignBreathingVoices();
+}
+
+void UPRFoleySignificanceSubsystem::AssignBreathingVoices() {
+  const int32 Budget = GetDefault<UPRFoleySettings>()->MaxRealBreathingVoices;
+
+  Breathers.Reset();
+  for (const TWeakObjectPtr<UPRFoleyComponent> &Weak : Components) {
+    UPRFoleyComponent *Component = Weak.Get();
+    if (!Component || !Component->IsBreathingAwake()) {
+      continue;
+    }
+    if (Budget <= 0) {
+      Component->SetBreathingVirtual(false);
+      continue;
+    }
+
+    float Relevance = Component->GetBreathingRelevance();
+    if (!Component->IsBreathingVirtual()) {
+      Relevance *= PRFoleySignificance::RealVoiceHysteresis;
+    }
+    Breathers.Emplace(Relevance, Component);
+  }
+
+  if (Breathers.Num() > Budget) {
+    Breathers.Sort([](const TPair<float, UPRFoleyComponent *> &A,
+                      const TPair<float, UPRFoleyComponent *> &B) {
+      return A.Key > B.Key;
+    });
+  }
+  for (int32 Index = 0; Index < Breathers.Num(); ++Index) {
+    Breathers[Index].Value->SetBreathingVirtual(Index >= Budget);
+  }
+}
+
+void UPRFoleySignificanceSubsystem::GatherListeners() {
+  Listeners.Reset();
+
+  UWorld *World = GetWorld();
+  if (!World) {
+    return;
+  }
+
+  for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator();
+       It; ++It) {
+    const APlayerController *PC = It->Get();
+    if (!PC || !PC->IsLocalController() || !PC->PlayerCameraManager) {
+      continue;
+    }
+
+    const APlayerCameraManager *Camera = PC->PlayerCameraManager;
+    const float FOVDegrees = FMath::Clamp(Camera->GetFOVAngle(), 1.0f, 170.0f);
+    const float HalfFOVRad = FMath::DegreesToRadians(FOVDegrees * 0.5f);
+    const float MarginRad =
+        FMath::DegreesToRadians(PRFoleySignificance::FOVMarginDegrees);
+
+    FListener &Listener = Listeners.AddDefaulted_GetRef();
+    Listener.Location = Camera->GetCameraLocation();
+    Listener.Forward = Camera->GetCameraRotation().Vector();
+    Listener.CosHalfFOV = FMath::Cos(FMath::Min(HalfFOVRad + MarginRad, UE_PI));
+    Listener.ScreenMultiple = 0.5f / FMath::Tan(HalfFOVRad);
+  }
+}
+
+void UPRFoleySignificanceSubsystem::EvaluateComponent(
+    UPRFoleyComponent &Component) const {
+  const UPRFootstepData *Data = Component.FootstepData;
+  const AActor *Owner = Component.GetOwner();
+
+  // Dedicated server: no layer plays; detection runs only if it feeds
+  // gameplay or the network
+  if (Component.IsServerStripped()) {
+    Component.Significance = Component.HasServerConsumer()
+                                 ? EPRFoleySignificance::AudioNoVoice
+                                 : EPRFoleySignificance::Culled;
+    Component.SignificantLayers = EPRFoleyLayerMask::None;
+    return;
+  }
+
+  // No listener or no data: nothing to rank against, keep everything.
+  if (Listeners.Num() == 0 || !Data || !Owner) {
+    Component.Significance = EPRFoleySignificance::Full;
+    Component.SignificantLayers = EPRFoleyLayerMask::All;
+    Component.UpdateBreathingSchedule(0.0f);
+    return;
+  }
+
+  const FVector Location = Owner->GetActorLocation();
+  const float BoundsRadius = Owner->GetSimpleCollisionHalfHeight();
+
+  // Closest listener drives audio; the best view drives visuals.
+  float MinDistSq = TNumericLimits<float>::Max();
+  float MaxScreenSize = 0.0f;
+  for (const FListener &Listener : Listeners) {
+    const FVector ToOwner = Location - Listener.Location;
+    const float DistSq = ToOwner.SizeSquared();
+    MinDistSq = FMath::Min(MinDistSq, DistSq);
+
+    const float Dist = FMath::Sqrt(DistSq);
+    const bool bInView =
+        Dist <= BoundsRadius ||
+        FVector::DotProduct(ToOwner / Dist, Listener.Forward) >=
+            Listener.CosHalfFOV;
+    if (bInView) {
+      const float ScreenSize = 2.0f * Listener.ScreenMultiple * BoundsRadius /
+                               FMath::Max(Dist, 1.0f);
+      MaxScreenSize = FMath::Max(MaxScreenSize, ScreenSize);
+    }
+  }
+
+  using namespace PRFoleySignificance;
+  const float AudioDistance = Data->MaxLODDistance;
+  const bool bVisible = MaxScreenSize >= Data->MinVisualScreenSize;
+
+  EPRFoleyLayerMask Layers = EPRFoleyLayerMask::None;
+  if (MinDistSq <= LayerRangeSq(0.0f, AudioDistance)) {
+    Layers |= EPRFoleyLayerMask::Audio;
+    if (MinDistSq <= LayerRangeSq(Data->BreathingMaxDistance, AudioDistance)) {
+      Layers |= EPRFoleyLayerMask::Voice;
+    }
+    if (bVisible &&
+        MinDistSq <= LayerRangeSq(Data->VFXMaxDistance, AudioDistance)) {
+      Layers |= EPRFoleyLayerMask::VFX;
+    }
+    if (bVisible &&
+        MinDistSq <= LayerRangeSq(Data->DecalMaxDistance, AudioDistance)) {
+      Layers |= EPRFoleyLayerMask::Decal;
+    }
+  }
+
+  EPRFoleySignificance Tier = EPRFoleySignificance::Culled;
+  if (EnumHasAnyFlags(Layers,
+                      EPRFoleyLayerMask::VFX | EPRFoleyLayerMask::Decal)) {
+    Tier = EPRFoleySignificance::Full;
+  } else if (EnumHasAnyFlags(Layers, EPRFoleyLayerMask::Voice)) {
+    Tier = EPRFoleySignificance::AudioOnly;
+  } else if (EnumHasAnyFlags(Layers, EPRFoleyLayerMask::Audio)) {
+    Tier = EPRFoleySignificance::AudioNoVoice;
+  }
+
+  Component.Significance = Tier;
+  Component.SignificantLayers = Layers;
+  Component.UpdateBreathingSchedule(MinDistSq);
+
+  // Out of voice range the persistent footstep voice is released; it is
+  // spawned again by the next event once the tier climbs back
+  if (!EnumHasAnyFlags(Layers, EPRFoleyLayerMask::Voice)) {
+    Component.StopFootstepVoice();
+  }
+}
@@ -0,0 +1,456 @@
+#include "Subsystems/PRFoleyStreamingSubsystem.h"
+#include "Data/PRFootstepData.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "PRAudioLog.h"
+#include "PRFoleySettings.h"
+#include "Sound/SoundWave.h"
+
+namespace {
+FAutoConsoleCommandWithWorld DumpSurfaceMemoryCommand(
+    TEXT("PRFoley.DumpSurfaceMemory"),
+    TEXT("Logs the resident memory of every streamed foley surface."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld *World) {
+      if (World) {
+        if (const UPRFoleyStreamingSubsystem *Streaming =
+                World->GetSubsystem<UPRFoleyStreamingSubsystem>()) {
+          Streaming->DumpSurfaceMemory();
+        }
+      }
+    }));
+
+FAutoConsoleCommandWithWorld DumpPrimedSoundsCommand(
+    TEXT("PRFoley.DumpPrimed"),
+    TEXT("Logs the foley sounds kept primed and those over budget."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld *World) {
+      if (World) {
+        if (const UPRFoleyStreamingSubsystem *Streaming =
+                World->GetSubsystem<UPRFoleyStreamingSubsystem>()) {
+          Streaming->DumpPrimedSounds();
+        }
+      }
+    }));
+} // namespace
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleyStreamingSubsystem::Deinitialize() {
+  for (TPair<FEntryKey, FEntry> &Pair : Entries) {
+    if (Pair.Value.Handle.IsValid()) {
+      Pair.Value.Handle->ReleaseHandle();
+    }
+  }
+  Entries.Empty();
+  TotalResidentBytes = 0;
+
+  for (const TPair<TObjectKey<USoundBase>, FPrimedSound> &Pair :
+       PrimedSounds) {
+    ReleasePrimedSound(Pair.Value);
+  }
+  PrimedSounds.Empty();
+  PrimedBytes = 0;
+  NumSkippedOverBudget = 0;
+  Super::Deinitialize();
+}
+
+// ============================================================================
+// Requests
+// ============================================================================
+
+bool UPRFoleyStreamingSubsystem::RequestSurface(const UPRFootstepData *Data,
+                                                EPhysicalSurface Surface,
+                                                bool bPin) {
+  if (!Data) {
+    return false;
+  }
+
+  const FEntryKey Key(Data, static_cast<uint8>(Surface));
+  FEntry *Entry = Entries.Find(Key);
+  if (Entry) {
+    Entry->LastUsedFrame = GFrameCounter;
+    Entry->PinCount += bPin ? 1 : 0;
+    return Entry->bResident;
+  }
+
+  TArray<FSoftObjectPath> Paths;
+  Data->GetSurfaceAssetPaths(Surface, Paths);
+
+  Entry = &Entries.Add(Key);
+  Entry->Data = Data;
+  Entry->Surface = Surface;
+  Entry->LastUsedFrame = GFrameCounter;
+  Entry->PinCount = bPin ? 1 : 0;
+
+  if (Paths.Num() == 0) {
+    Entry->bResident = true;
+    return true;
+  }
+
+  FStreamableManager &Streamable = UAssetManager::GetStreamableManager();
+  const UWorld *World = GetWorld();
+  if (!World || !World->IsGameWorld()) {
+    Entry->Handle = Streamable.RequestSyncLoad(Paths);
+    Entry->bResident = !Entry->Handle.IsValid();
+    OnSurfaceLoaded(Key);
+    return true;
+  }
+
+  TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(
+      Paths,
+      FStreamableDelegate::CreateUObject(
+          this, &UPRFoleyStreamingSubsystem::OnSurfaceLoaded, Key),
+      FStreamableManager::AsyncLoadHighPriority);
+
+  Entry = Entries.Find(Key);
+  if (!Entry) {
+    return false;
+  }
+  Entry->Handle = Handle;
+
+  // No handle: nothing valid to load. Already in memory: complete now rather
+  // than waiting for the delegate.
+  if (!Handle.IsValid()) {
+    Entry->bResident = true;
+  } else if (Handle->HasLoadCompleted()) {
+    OnSurfaceLoaded(Key);
+  }
+  return Entry->bResident;
+}
+
+void UPRFoleyStreamingSubsystem::UnpinSurface(const UPRFootstepData *Data,
+                                               EPhysicalSurface Surface) {
+  FEntry *Entry = Entries.Find(FEntryKey(Data, static_cast<uint8>(Surface)));
+  if (!Entry || Entry->PinCount <= 0) {
+    return;
+  }
+  if (--Entry->PinCount == 0) {
+    // Back under the LRU budget, which may now be exceeded
+    EnforceBudget();
+  }
+}
+
+bool UPRFoleyStreamingSubsystem::IsSurfaceResident(
+    const UPRFootstepData *Data, EPhysicalSurface Surface) const {
+  const FEntry *Entry =
+      Entries.Find(FEntryKey(Data, static_cast<uint8>(Surface)));
+  return Entry && Entry->bResident;
+}
+
+void UPRFoleyStreamingSubsystem::OnSurfaceLoaded(FEntryKey Key) {
+  // The handle is not stored yet if the delegate fires inside the request
+  FEntry *Entry = Entries.Find(Key);
+  if (!Entry || Entry->bResident || !Entry->Handle.IsValid()) {
+    return;
+  }
+
+  Entry->bResident = true;
+  Entry->ResidentBytes = 0;
+
+  TArray<UObject *> LoadedAssets;
+  Entry->Handle->GetLoadedAssets(LoadedAssets);
+  for (const UObject *Asset : LoadedAssets) {
+    if (Asset) {
+      Entry->ResidentBytes +=
+          Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+    }
+  }
+  TotalResidentBytes += Entry->ResidentBytes;
+
+  if (Entry->Prewarm == EPrewarm::Pending) {
+    HoldPrewarmSurface(Key, *Entry);
+  }
+
+  EnforceBudget();
+}
+
+// ============================================================================
+// Budget
+// ============================================================================
+
+void UPRFoleyStreamingSubsystem::EnforceBudget() {
+  const int32 BudgetMB = GetDefault<UPRFoleySettings>()->SurfaceAssetBudgetMB;
+  if (BudgetMB <= 0) {
+    return;
+  }
+
+  const int64 BudgetBytes = static_cast<int64>(BudgetMB) * 1024 * 1024;
+  while (TotalResidentBytes > BudgetBytes) {
+    // Least recently used, never a pinned surface or one used this frame
+    FEntryKey OldestKey;
+    const FEntry *Oldest = nullptr;
+    for (const TPair<FEntryKey, FEntry> &Pair : Entries) {
+      const FEntry &Entry = Pair.Value;
+      if (!Entry.bResident || Entry.PinCount > 0 ||
+          Entry.Prewarm == EPrewarm::Held ||
+          Entry.LastUsedFrame == GFrameCounter) {
+        continue;
+      }
+      if (!Oldest || Entry.LastUsedFrame < Oldest->LastUsedFrame) {
+        Oldest = &Entry;
+        OldestKey = Pair.Key;
+      }
+    }
+
+    if (!Oldest) {
+      return;
+    }
+
+    UE_LOG(LogPRAudio, Verbose,
+           TEXT("[PRFoley] Releasing surface %d of %s (%lld bytes)"),
+           static_cast<int32>(Oldest->Surface),
+           *GetNameSafe(Oldest->Data.Get()), Oldest->ResidentBytes);
+
+    TotalResidentBytes -= Oldest->ResidentBytes;
+    if (Oldest->Handle.IsValid()) {
+      Oldest->Handle->ReleaseHandle();
+    }
+    ReleasePrimedSounds(OldestKey);
+    Entries.Remove(OldestKey);
+  }
+}
+
+// ============================================================================
+// Prewarm
+// ============================================================================
+
+void UPRFoleyStreamingSubsystem::PrewarmFootstepData(
+    const UPRFootstepData *Data) {
+  const UWorld *World = GetWorld();
+  if (!Data || !World || !World->IsGameWorld() ||
+      !GetDefault<UPRFoleySettings>()->bPrewarmSounds) {
+    return;
+  }
+
+  PruneHeldSurfaces();
+
+  TArray<EPhysicalSurface, TInlineAllocator<16>> Surfaces;
+  Surfaces.Add(SurfaceType_Default);
+  for (const FPRSurfaceFoleyConfig &Config : Data->Surfaces) {
+    Surfaces.AddUnique(Config.Surface.GetValue());
+  }
+
+  for (const EPhysicalSurface Surface : Surfaces) {
+    const FEntryKey Key(Data, static_cast<uint8>(Surface));
+    const FEntry *Existing = Entries.Find(Key);
+    if (Existing && Existing->Prewarm != EPrewarm::None) {
+      continue;
+    }
+    // Budget full: do not start loads that could only be evicted again
+    if (!Existing && !FitsPrewarmBudget(0)) {
+      ++NumSkippedOverBudget;
+      continue;
+    }
+
+    RequestSurface(Data, Surface);
+
+    // Loaded surfaces are held now, the others from OnSurfaceLoaded
+    if (FEntry *Entry = Entries.Find(Key)) {
+      Entry->Prewarm = EPrewarm::Pending;
+      if (Entry->bResident) {
+        HoldPrewarmSurface(Key, *Entry);
+      }
+    }
+  }
+
+  if (USoundBase *MetaSound = Data->FootstepMetaSound) {
+    PrimeSound(MetaSound);
+  }
+}
+
+void UPRFoleyStreamingSubsystem::PrewarmSounds(
+    TConstArrayView<USoundBase *> Sounds) {
+  const UWorld *World = GetWorld();
+  if (!World || !World->IsGameWorld() ||
+      !GetDefault<UPRFoleySettings>()->bPrewarmSounds) {
+    return;
+  }
+
+  PruneHeldSurfaces();
+  for (USoundBase *Sound : Sounds) {
+    PrimeSound(Sound);
+  }
+}
+
+void UPRFoleyStreamingSubsystem::HoldPrewarmSurface(const FEntryKey &Key,
+                                                    FEntry &Entry) {
+  if (!FitsPrewarmBudget(Entry.ResidentBytes)) {
+    Entry.Prewarm = EPrewarm::OverBudget;
+    ++NumSkippedOverBudget;
+    UE_LOG(LogPRAudio, Verbose,
+           TEXT("[PRFoley] Prewarm budget full, surface %d of %s left to LRU"),
+           static_cast<int32>(Entry.Surface), *GetNameSafe(Entry.Data.Get()));
+    return;
+  }
+
+  // Out of the LRU budget: evicting it would only make the next prewarm
+  // load it again
+  Entry.Prewarm = EPrewarm::Held;
+  TotalResidentBytes -= Entry.ResidentBytes;
+  PrimedBytes += Entry.ResidentBytes;
+  PrimeEntrySounds(Key, Entry);
+}
+
+void UPRFoleyStreamingSubsystem::PruneHeldSurfaces() {
+  for (auto It = Entries.CreateIterator(); It; ++It) {
+    FEntry &Entry = It->Value;
+    if (Entry.Prewarm != EPrewarm::Held || Entry.Data.IsValid()) {
+      continue;
+    }
+    PrimedBytes -= Entry.ResidentBytes;
+    if (Entry.Handle.IsValid()) {
+      Entry.Handle->ReleaseHandle();
+    }
+    ReleasePrimedSounds(It->Key);
+    It.RemoveCurrent();
+  }
+}
+
+bool UPRFoleyStreamingSubsystem::FitsPrewarmBudget(int64 Bytes) {
+  const int32 BudgetMB = GetDefault<UPRFoleySettings>()->PrewarmBudgetMB;
+  if (BudgetMB <= 0) {
+    return true;
+  }
+  const int64 BudgetBytes = static_cast<int64>(BudgetMB) * 1024 * 1024;
+  if (PrimedBytes + Bytes > BudgetBytes) {
+    // Collected sounds may still hold budget
+    PrunePrimedSounds();
+  }
+  return PrimedBytes + Bytes <= BudgetBytes;
+}
+
+void UPRFoleyStreamingSubsystem::PrimeEntrySounds(const FEntryKey &Key,
+                                                  const FEntry &Entry) {
+  if (!Entry.Handle.IsValid()) {
+    return;
+  }
+
+  TArray<UObject *> LoadedAssets;
+  Entry.Handle->GetLoadedAssets(LoadedAssets);
+  for (UObject *Asset : LoadedAssets) {
+    PrimeSound(Cast<USoundBase>(Asset), &Key);
+  }
+}
+
+void UPRFoleyStreamingSubsystem::PrimeSound(USoundBase *Sound,
+                                            const FEntryKey *Surface) {
+  if (!Sound || PrimedSounds.Contains(Sound)) {
+    return;
+  }
+
+  // A held surface's sounds are already counted in its resident bytes
+  const int64 Bytes =
+      Surface ? 0
+              : Sound->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+  if (!FitsPrewarmBudget(Bytes)) {
+    ++NumSkippedOverBudget;
+    UE_LOG(LogPRAudio, Verbose,
+           TEXT("[PRFoley] Prewarm budget full, not priming %s (%lld bytes)"),
+           *GetNameSafe(Sound), Bytes);
+    return;
+  }
+
+  // Fetches the first chunk into the stream cache (cues prime every wave)
+  UGameplayStatics::PrimeSound(Sound);
+
+  FPrimedSound &Primed = PrimedSounds.Add(Sound);
+  Primed.Sound = Sound;
+  Primed.Bytes = Bytes;
+  if (Surface) {
+    Primed.Surface = *Surface;
+  }
+
+  // Keeps that chunk resident instead of letting the cache evict it
+  if (USoundWave *Wave = Cast<USoundWave>(Sound)) {
+    if (Wave->IsStreaming()) {
+      Wave->RetainCompressedAudio();
+      Primed.bRetained = true;
+    }
+  }
+  PrimedBytes += Bytes;
+}
+
+void UPRFoleyStreamingSubsystem::ReleasePrimedSounds(const FEntryKey &Key) {
+  for (auto It = PrimedSounds.CreateIterator(); It; ++It) {
+    if (It->Value.Surface.IsSet() && It->Value.Surface.GetValue() == Key) {
+      ReleasePrimedSound(It->Value);
+      It.RemoveCurrent();
+    }
+  }
+}
+
+void UPRFoleyStreamingSubsystem::PrunePrimedSounds() {
+  for (auto It = PrimedSounds.CreateIterator(); It; ++It) {
+    if (!It->Value.Sound.IsValid()) {
+      ReleasePrimedSound(It->Value);
+      It.RemoveCurrent();
+    }
+  }
+}
+
+void UPRFoleyStreamingSubsystem::ReleasePrimedSound(
+    const FPrimedSound &Primed) {
+  USoundWave *Wave = Cast<USoundWave>(Primed.Sound.Get());
+  if (Wave && Primed.bRetained) {
+    Wave->ReleaseCompressedAudio();
+  }
+  PrimedBytes -= Primed.Bytes;
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+TArray<FPRFoleySurfaceMemory>
+UPRFoleyStreamingSubsystem::GetResidentSurfaces() const {
+  TArray<FPRFoleySurfaceMemory> Result;
+  Result.Reserve(Entries.Num());
+  for (const TPair<FEntryKey, FEntry> &Pair : Entries) {
+    FPRFoleySurfaceMemory &Memory = Result.AddDefaulted_GetRef();
+    Memory.FootstepData = Pair.Value.Data.Get();
+    Memory.Surface = Pair.Value.Surface;
+    Memory.ResidentBytes = Pair.Value.ResidentBytes;
+    Memory.bLoading = !Pair.Value.bResident;
+    Memory.bPinned =
+        Pair.Value.PinCount > 0 || Pair.Value.Prewarm == EPrewarm::Held;
+  }
+  return Result;
+}
+
+void UPRFoleyStreamingSubsystem::DumpSurfaceMemory() const {
+  UE_LOG(LogPRAudio, Log, TEXT("[PRFoley] Streamed surfaces: %d, %.2f MB"),
+         Entries.Num(), TotalResidentBytes / (1024.0 * 1024.0));
+  for (const FPRFoleySurfaceMemory &Memory : GetResidentSurfaces()) {
+    UE_LOG(LogPRAudio, Log, TEXT("[PRFoley]   %s / surface %d: %.2f MB%s%s"),
+           *GetNameSafe(Memory.FootstepData),
+           static_cast<int32>(Memory.Surface.GetValue()),
+           Memory.ResidentBytes / (1024.0 * 1024.0),
+           Memory.bLoading ? TEXT(" (loading)") : TEXT(""),
+           Memory.bPinned ? TEXT(" (pinned)") : TEXT(""));
+  }
+}
+
+void UPRFoleyStreamingSubsystem::DumpPrimedSounds() const {
+  int32 NumHeld = 0;
+  for (const TPair<FEntryKey, FEntry> &Pair : Entries) {
+    NumHeld += Pair.Value.Prewarm == EPrewarm::Held;
+  }
+  UE_LOG(LogPRAudio, Log,
+         TEXT("[PRFoley] Prewarm: %.2f MB, %d surfaces held, %d sounds "
+              "primed, %d over budget"),
+         PrimedBytes / (1024.0 * 1024.0), NumHeld, PrimedSounds.Num(),
+         NumSkippedOverBudget);
+  for (const TPair<TObjectKey<USoundBase>, FPrimedSound> &Pair :
+       PrimedSounds) {
+    const FPrimedSound &Primed = Pair.Value;
+    UE_LOG(LogPRAudio, Log, TEXT("[PRFoley]   %s: %.2f MB%s%s%s"),
+           *GetNameSafe(Primed.Sound.Get()), Primed.Bytes / (1024.0 * 1024.0),
+           Primed.Surface.IsSet() ? TEXT(" (in held surface)") : TEXT(""),
+           Primed.bRetained ? TEXT(" (first chunk retained)") : TEXT(""),
+           Primed.Sound.IsValid() ? TEXT("") : TEXT(" (unloaded)"));
+  }
+}
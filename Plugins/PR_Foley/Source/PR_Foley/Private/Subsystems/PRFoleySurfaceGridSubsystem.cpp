@@ -0,0 +1,108 @@
+#include "Subsystems/PRFoleySurfaceGridSubsystem.h"
+#include "Engine/World.h"
+#include "PRAudioLog.h"
+#include "PRFoleySettings.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+bool UPRFoleySurfaceGridSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPRFoleySurfaceGridSubsystem::Deinitialize() {
+  Grid.Reset();
+  SurfaceMaterials.Empty();
+  Super::Deinitialize();
+}
+
+void UPRFoleySurfaceGridSubsystem::OnWorldBeginPlay(UWorld &InWorld) {
+  Super::OnWorldBeginPlay(InWorld);
+
+  if (!GetDefault<UPRFoleySettings>()->bUseSurfaceGrid) {
+    return;
+  }
+
+  const FString MapName =
+      UWorld::RemovePIEPrefix(InWorld.GetPackage()->GetName());
+  const FString Filename = FPRFoleySurfaceGrid::GetFilenameForMap(MapName);
+  if (Grid.Load(Filename)) {
+    const FPRFoleySurfaceGridHeader &Header = Grid.GetHeader();
+    UE_LOG(LogPRAudio, Log,
+           TEXT("[PRFoley] Surface grid loaded for %s: %dx%d cells of %.0f "
+                "cm (%s)"),
+           *MapName, Header.SizeX, Header.SizeY, Header.CellSize,
+           Grid.IsMemoryMapped() ? TEXT("mapped") : TEXT("in memory"));
+  }
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+UPhysicalMaterial *
+UPRFoleySurfaceGridSubsystem::GetSurfaceMaterial(EPhysicalSurface Surface) {
+  if (SurfaceMaterials.Num() == 0) {
+    SurfaceMaterials.SetNum(SurfaceType_Max);
+  }
+  TObjectPtr<UPhysicalMaterial> &Material = SurfaceMaterials[Surface];
+  if (!Material) {
+    Material = NewObject<UPhysicalMaterial>(this);
+    Material->SurfaceType = Surface;
+  }
+  return Material;
+}
+
+bool UPRFoleySurfaceGridSubsystem::TraceGrid(const FVector &Start,
+                                             const FVector &End,
+                                             FHitResult &OutHit) {
+  // Only straight-down traces map onto a 2D grid
+  if (!FMath::IsNearlyEqual(Start.X, End.X) ||
+      !FMath::IsNearlyEqual(Start.Y, End.Y) || Start.Z <= End.Z) {
+    return false;
+  }
+
+  const FPRFoleySurfaceCell *Cell = Grid.FindCell(Start);
+  if (!Cell || !Cell->IsStaticGround()) {
+    return false;
+  }
+
+  // Height on the cell's ground plane, so slopes stay accurate
+  const FVector Normal = Cell->GetNormal();
+  const FVector2D Center = Grid.GetCellCenter(Start);
+  const float Height =
+      Cell->Height - (Normal.X * (Start.X - Center.X) +
+                      Normal.Y * (Start.Y - Center.Y)) /
+                         FMath::Max(Normal.Z, UE_KINDA_SMALL_NUMBER);
+  if (Height > Start.Z || Height < End.Z) {
+    return false;
+  }
+
+  const FVector ImpactPoint(Start.X, Start.Y, Height);
+  OutHit = FHitResult(Start, End);
+  OutHit.bBlockingHit = true;
+  OutHit.Time = (Start.Z - Height) / (Start.Z - End.Z);
+  OutHit.Distance = Start.Z - Height;
+  OutHit.Location = ImpactPoint;
+  OutHit.ImpactPoint = ImpactPoint;
+  OutHit.Normal = Normal;
+  OutHit.ImpactNormal = Normal;
+  OutHit.PhysMaterial = GetSurfaceMaterial(
+      static_cast<EPhysicalSurface>(Cell->PrimarySurface));
+  return true;
+}
+
+bool UPRFoleySurfaceGridSubsystem::GetBlendSurface(
+    const FVector &Location, EPhysicalSurface &OutSecondarySurface,
+    float &OutSecondaryWeight) const {
+  const FPRFoleySurfaceCell *Cell = Grid.FindCell(Location);
+  if (!Cell || !Cell->IsStaticGround() || Cell->SecondaryWeight == 0) {
+    return false;
+  }
+  OutSecondarySurface = static_cast<EPhysicalSurface>(Cell->SecondarySurface);
+  OutSecondaryWeight = Cell->SecondaryWeight / 255.0f;
+  return true;
+}
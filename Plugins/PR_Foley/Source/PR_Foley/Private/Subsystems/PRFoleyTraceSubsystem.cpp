@@ -0,0 +1,146 @@
+#include "Subsystems/PRFoleyTraceSubsystem.h"
+#include "Algo/BinarySearch.h"
+#include "Engine/World.h"
+#include "PRFoleyComponent.h"
+#include "PRFoleySettings.h"
+#include "PRFoleyStats.h"
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UPRFoleyTraceSubsystem::Initialize(
+    FSubsystemCollectionBase &Collection) {
+  Super::Initialize(Collection);
+  TraceDelegate.BindUObject(this, &UPRFoleyTraceSubsystem::OnTraceCompleted);
+}
+
+void UPRFoleyTraceSubsystem::Deinitialize() {
+  // In-flight results may still be delivered; the handler ignores unknown ids.
+  PendingRequests.Empty();
+  InFlightRequests.Empty();
+  TraceDelegate.Unbind();
+  Super::Deinitialize();
+}
+
+bool UPRFoleyTraceSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UPRFoleyTraceSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UPRFoleyTraceSubsystem, STATGROUP_PRFoley);
+}
+
+// ============================================================================
+// Requests
+// ============================================================================
+
+bool UPRFoleyTraceSubsystem::RequestTrace(const FPRFoleyTraceRequest &Request) {
+  if (!GetWorld() || !Request.Component.IsValid()) {
+    return false;
+  }
+  FPRFoleyTraceRequest &Queued = PendingRequests.Add_GetRef(Request);
+  Queued.QueuedFrame = GFrameCounter;
+  return true;
+}
+
+void UPRFoleyTraceSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+  TRACE_CPUPROFILER_EVENT_SCOPE(UPRFoleyTraceSubsystem_Tick);
+
+  if (PendingRequests.Num() == 0) {
+    return;
+  }
+
+  const UPRFoleySettings *Settings = GetDefault<UPRFoleySettings>();
+
+  // A step traced seconds late is worse than a missing one: drop the oldest
+  // requests once they have waited MaxTraceQueueFrames.
+  const uint64 MaxAge = static_cast<uint64>(Settings->MaxTraceQueueFrames);
+  int32 NumExpired = 0;
+  while (NumExpired < PendingRequests.Num() &&
+         GFrameCounter - PendingRequests[NumExpired].QueuedFrame > MaxAge) {
+    ++NumExpired;
+  }
+  if (NumExpired > 0) {
+    PRFOLEY_COUNT(TracesDropped, NumExpired);
+  }
+
+  const int32 NumToSubmit = FMath::Min(Settings->MaxAsyncTracesPerFrame,
+                                       PendingRequests.Num() - NumExpired);
+
+  for (int32 Index = NumExpired; Index < NumExpired + NumToSubmit; ++Index) {
+    SubmitRequest(MoveTemp(PendingRequests[Index]));
+  }
+
+  // Single shift for the whole batch; the remainder keeps its FIFO order.
+  PendingRequests.RemoveAt(0, NumExpired + NumToSubmit, EAllowShrinking::No);
+}
+
+void UPRFoleyTraceSubsystem::SubmitRequest(FPRFoleyTraceRequest &&Request) {
+  UPRFoleyComponent *Component = Request.Component.Get();
+  UWorld *World = GetWorld();
+  if (!Component || !World) {
+    return;
+  }
+
+  const uint32 RequestId = NextRequestId++;
+  if (NextRequestId == 0) {
+    NextRequestId = 1;
+  }
+
+  const FCollisionQueryParams &Params = Component->GetFoleyQueryParams();
+
+  if (Request.Shape.IsLine()) {
+    World->AsyncLineTraceByChannel(
+        EAsyncTraceType::Single, Request.Start, Request.End, Request.Channel,
+        Params, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate,
+        RequestId);
+  } else {
+    World->AsyncSweepByChannel(EAsyncTraceType::Single, Request.Start,
+                               Request.End, FQuat::Identity, Request.Channel,
+                               Request.Shape, Params,
+                               FCollisionResponseParams::DefaultResponseParam,
+                               &TraceDelegate, RequestId);
+  }
+
+  PRFOLEY_COUNT(TracesIssued, 1);
+  InFlightRequests.Add(RequestId, MoveTemp(Request));
+}
+
+void UPRFoleyTraceSubsystem::OnTraceCompleted(const FTraceHandle &Handle,
+                                              FTraceDatum &Datum) {
+  FPRFoleyTraceRequest Request;
+  if (!InFlightRequests.RemoveAndCopyValue(Datum.UserData, Request)) {
+    return;
+  }
+
+  UPRFoleyComponent *Component = Request.Component.Get();
+  if (!Component) {
+    return;
+  }
+
+  const FHitResult *BlockingHit = Datum.OutHits.FindByPredicate(
+      [](const FHitResult &Hit) { return Hit.bBlockingHit; });
+
+  // Multi: the sweep missed, queue the line fallback by its original age so
+  // it neither starves behind newer requests nor jumps ahead of older ones.
+  if (!BlockingHit && Request.bLineFallback) {
+    Request.bLineFallback = false;
+    Request.Shape = FCollisionShape::LineShape;
+    const int32 InsertIndex =
+        Algo::UpperBoundBy(PendingRequests, Request.QueuedFrame,
+                           [](const FPRFoleyTraceRequest &Pending) {
+                             return Pending.QueuedFrame;
+                           });
+    PendingRequests.Insert(MoveTemp(Request), InsertIndex);
+    return;
+  }
+
+  const bool bHit = BlockingHit != nullptr;
+  const FHitResult Hit = bHit ? *BlockingHit : FHitResult();
+  Component->DrawTraceDebug(Request.Start, Request.End, bHit, Hit);
+  Component->OnAsyncTraceCompleted(Request.EventType, bHit, Hit,
+                                   Request.FallSpeed, Request.StartDelay);
+}
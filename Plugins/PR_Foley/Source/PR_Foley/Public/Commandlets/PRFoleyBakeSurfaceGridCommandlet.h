@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "PRFoleyBakeSurfaceGridCommandlet.generated.h"
+
+/**
+ * Bakes the static walkable ground of maps into surface grids
+ * (FPRFoleySurfaceGrid) saved next to each map as <Map>.pfgrid.
+ *
+ *   UnrealEditor-Cmd Project.uproject -run=PRFoleyBakeSurfaceGrid
+ *     -Map=/Game/Maps/A+/Game/Maps/B [-CellSize=50] [-Channel=<index>]
+ *     [-WalkableZ=0.7] [-Headroom=150] [-StepHeight=30] [-MaxCells=100000000]
+ *
+ * CellSize defaults to UPRFoleySettings::SurfaceGridCellSize and Channel
+ * (an ECollisionChannel index) to ECC_Visibility, like
+ * UPRFootstepData::TraceChannel.
+ *
+ * Each cell traces down at its center and four inner points: ground height
+ * and normal come from the center, dominant and secondary surfaces from the
+ * five samples (landscape samples use their weightmap blend). Cells whose
+ * ground is movable are flagged Dynamic; cells with walkable ground below
+ * the first one (within Headroom) or with samples further apart than
+ * StepHeight are flagged MultiLevel. Both keep tracing at runtime.
+ *
+ * Maps with landscapes also get <Map>.pfland: the decoded weightmap weights
+ * of every landscape component, which cooked builds cannot read back from
+ * the textures (see UPRFoleyLandscapeSubsystem).
+ *
+ * Sublevels are loaded before baking. World Partition maps only bake the
+ * actors that are loaded with the map.
+ */
+UCLASS()
+class UPRFoleyBakeSurfaceGridCommandlet : public UCommandlet {
+  GENERATED_BODY()
+
+public:
+  UPRFoleyBakeSurfaceGridCommandlet();
+
+  virtual int32 Main(const FString &Params) override;
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Chaos/ChaosEngineInterface.h"
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+enum class EPRFoleySurfaceCellFlags : uint8 {
+  None = 0,
+  /** Walkable static ground was found: Height and surfaces are valid. */
+  Walkable = 1 << 0,
+  /** Ground was movable at bake time: always trace. */
+  Dynamic = 1 << 1,
+  /** Several walkable levels or a ledge inside the cell: always trace. */
+  MultiLevel = 1 << 2,
+};
+ENUM_CLASS_FLAGS(EPRFoleySurfaceCellFlags);
+
+/** One grid cell, as stored on disk. */
+struct FPRFoleySurfaceCell {
+  /** Ground height at the cell center (world Z). */
+  float Height = 0.0f;
+  /** Ground normal X/Y * 127; Z is rebuilt (always up-facing). */
+  int8 NormalX = 0;
+  int8 NormalY = 0;
+  uint8 PrimarySurface = SurfaceType_Default;
+  uint8 SecondarySurface = SurfaceType_Default;
+  /** Secondary surface weight * 255. */
+  uint8 SecondaryWeight = 0;
+  EPRFoleySurfaceCellFlags Flags = EPRFoleySurfaceCellFlags::None;
+  uint8 Padding[2] = {0, 0};
+
+  /** True if a vertical trace in this cell can be answered from the grid. */
+  bool IsStaticGround() const {
+    return Flags == EPRFoleySurfaceCellFlags::Walkable;
+  }
+
+  FVector GetNormal() const;
+};
+static_assert(sizeof(FPRFoleySurfaceCell) == 12, "Surface grid file layout");
+
+struct FPRFoleySurfaceGridHeader {
+  uint32 Magic = 0;
+  uint32 Version = 0;
+  double OriginX = 0.0;
+  double OriginY = 0.0;
+  float CellSize = 0.0f;
+  int32 SizeX = 0;
+  int32 SizeY = 0;
+  uint32 Reserved = 0;
+};
+static_assert(sizeof(FPRFoleySurfaceGridHeader) == 40,
+              "Surface grid file layout");
+
+/**
+ * Baked 2D world grid of static ground (see UPRFoleyBakeSurfaceGridCommandlet)
+ * saved next to the map as <Map>.pfgrid: a header followed by SizeX * SizeY
+ * row-major cells. Loading memory-maps the file when the platform allows it
+ * and reads it into memory otherwise.
+ */
+class PR_FOLEY_API FPRFoleySurfaceGrid {
+public:
+  static constexpr uint32 FileMagic = 0x47534650; // "PFSG"
+  static constexpr uint32 FileVersion = 1;
+
+  FPRFoleySurfaceGrid();
+  ~FPRFoleySurfaceGrid();
+
+  /** Content/<path>/<Map>.pfgrid for a map's long package name. */
+  static FString GetFilenameForMap(const FString &MapPackageName);
+
+  static bool Save(const FString &Filename,
+                   const FPRFoleySurfaceGridHeader &Header,
+                   TConstArrayView<FPRFoleySurfaceCell> Cells);
+
+  bool Load(const FString &Filename);
+  void Reset();
+
+  bool IsLoaded() const { return Cells != nullptr; }
+
+  const FPRFoleySurfaceGridHeader &GetHeader() const { return Header; }
+
+  /** Cell containing Location (XY only), or null outside the grid. */
+  const FPRFoleySurfaceCell *FindCell(const FVector &Location) const;
+
+  /** World XY of a cell's center. */
+  FVector2D GetCellCenter(const FVector &Location) const;
+
+  bool IsMemoryMapped() const { return MappedRegion.IsValid(); }
+
+private:
+  FPRFoleySurfaceGridHeader Header;
+  const FPRFoleySurfaceCell *Cells = nullptr;
+
+  TUniquePtr<IMappedFileHandle> MappedFile;
+  TUniquePtr<IMappedFileRegion> MappedRegion;
+  TArray64<uint8> FileData;
+};
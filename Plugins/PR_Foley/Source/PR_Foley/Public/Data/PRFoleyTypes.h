@@ -2,6 +2,7 @@
 
 #include "Chaos/ChaosEngineInterface.h"
 #include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
 #include "Sound/SoundAttenuation.h"
 #include "Sound/SoundConcurrency.h"
 #include "Sound/SoundEffectSource.h"
@@ -22,6 +23,46 @@ enum class EPRVelocityTier : uint8 { Idle, Walk, Jog, Sprint };
 UENUM(BlueprintType)
 enum class EPRFoleyEventType : uint8 { Footstep, Jump, Land };
 
+/** How foley reaches other machines when network replication is on. */
+UENUM(BlueprintType)
+enum class EPRFoleyNetMode : uint8 {
+  /** Every event goes owning client -> server -> multicast. */
+  ServerRelayed,
+  /**
+   * Each machine detects footsteps and jumps itself from replicated
+   * movement and animation. Only lands (heavy flag, fall speed) are
+   * multicast by the server.
+   */
+  LocalSimulation
+};
+
+/**
+ * Per-frame significance tier assigned by UPRFoleySignificanceSubsystem from
+ * the distance to every local listener and the on-screen size.
+ */
+UENUM(BlueprintType)
+enum class EPRFoleySignificance : uint8 {
+  /** Audio, voice and visual layers (VFX / decals within their ranges). */
+  Full,
+  /** Footstep audio and voice, no visual layers. */
+  AudioOnly,
+  /** Footstep audio only; voice and breathing are skipped. */
+  AudioNoVoice,
+  /** Beyond every listener's range; nothing plays. */
+  Culled
+};
+
+/** Layers a significance tier allows (see EPRFoleySignificance). */
+enum class EPRFoleyLayerMask : uint8 {
+  None = 0,
+  Audio = 1 << 0,
+  Voice = 1 << 1,
+  VFX = 1 << 2,
+  Decal = 1 << 3,
+  All = Audio | Voice | VFX | Decal
+};
+ENUM_CLASS_FLAGS(EPRFoleyLayerMask);
+
 /**
  * A set of sound variations for a single purpose (e.g. one surface's
  * footstep). Fill with 3+ sounds for natural variation. The shuffle system
@@ -32,7 +73,7 @@ struct FPRSurfaceSoundSet {
   GENERATED_BODY()
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound Set")
-  TArray<TObjectPtr<USoundBase>> Sounds;
+  TArray<TSoftObjectPtr<USoundBase>> Sounds;
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound Set")
   bool bShuffleNoRepeat = true;
@@ -76,13 +117,13 @@ struct FPRSurfaceVFXSet {
   GENERATED_BODY()
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VFX")
-  TObjectPtr<UNiagaraSystem> FootstepVFX;
+  TSoftObjectPtr<UNiagaraSystem> FootstepVFX;
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VFX")
-  TObjectPtr<UNiagaraSystem> JumpVFX;
+  TSoftObjectPtr<UNiagaraSystem> JumpVFX;
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VFX")
-  TObjectPtr<UNiagaraSystem> LandVFX;
+  TSoftObjectPtr<UNiagaraSystem> LandVFX;
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VFX",
             meta = (ClampMin = "0.01", ClampMax = "10.0"))
@@ -99,7 +140,7 @@ struct FPRSurfaceDecalSet {
   GENERATED_BODY()
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Decals")
-  TObjectPtr<UMaterialInterface> DecalMaterial;
+  TSoftObjectPtr<UMaterialInterface> DecalMaterial;
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Decals")
   FName FrameIndexParamName = FName("FrameIndex");
@@ -127,6 +168,8 @@ struct FPRSurfaceDecalSet {
 /**
  * Per-surface sound configuration. Maps a Physical Surface type to
  * footstep sounds, with optional per-surface jump/land overrides.
+ * Sounds, VFX and decal materials are soft references streamed per surface
+ * by UPRFoleyStreamingSubsystem.
  */
 USTRUCT(BlueprintType)
 struct FPRSurfaceFoleyConfig {
@@ -164,3 +207,44 @@ struct FPRSurfaceFoleyConfig {
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surfaces")
   float PitchMultiplier = 1.0f;
 };
+
+/** One foley event waiting in a FPRFoleyNetEventBatch. */
+struct FPRFoleyNetEvent {
+  FVector Location = FVector::ZeroVector;
+  FVector Normal = FVector::UpVector;
+  EPhysicalSurface Surface = SurfaceType_Default;
+  EPRFoleyEventType EventType = EPRFoleyEventType::Footstep;
+  EPRVelocityTier VelocityTier = EPRVelocityTier::Idle;
+  bool bHeavyLand = false;
+
+  /** Seconds after the batch's first event (4 ms steps, up to ~1 s). */
+  float TimeOffset = 0.0f;
+
+  /** Sender only, not replicated: world time the event happened at. */
+  double Time = 0.0;
+};
+
+/**
+ * Foley events of one actor gathered over a net update and sent as a single
+ * RPC. NetSerialize packs surface, event type, tier and heavy flag in 11
+ * bits, locations as 1 cm offsets from Origin (30 bits when within 5 m),
+ * ground normals in 16 bits and each event's time offset in 8 bits, so
+ * receivers replay the steps with their original spacing.
+ */
+USTRUCT()
+struct PR_FOLEY_API FPRFoleyNetEventBatch {
+  GENERATED_BODY()
+
+  static constexpr int32 MaxEvents = 32;
+
+  FVector Origin = FVector::ZeroVector;
+  TArray<FPRFoleyNetEvent> Events;
+
+  bool NetSerialize(FArchive &Ar, UPackageMap *Map, bool &bOutSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FPRFoleyNetEventBatch>
+    : public TStructOpsTypeTraitsBase2<FPRFoleyNetEventBatch> {
+  enum { WithNetSerializer = true };
+};
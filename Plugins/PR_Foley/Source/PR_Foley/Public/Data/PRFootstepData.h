@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Chaos/ChaosEngineInterface.h"
+#include "Containers/StaticArray.h"
 #include "CoreMinimal.h"
 #include "Data/PRFoleyTypes.h"
 #include "Engine/DataAsset.h"
@@ -16,7 +17,43 @@ enum class EPRTraceType : uint8 { Line, Sphere, Box, Multi };
 UENUM(BlueprintType)
 enum class EPRTraceStartReference : uint8 { Capsule, Root, Socket };
 
+/** How footprints are rendered (see UPRFootstepData::FootprintBackend). */
+UENUM(BlueprintType)
+enum class EPRFootprintBackend : uint8 {
+  /** One pooled deferred decal per footprint. */
+  Decal,
+  /** One instance in a world-level ISM per (mesh, material). */
+  InstancedMesh
+};
+
 class USoundBase;
+class UStaticMesh;
+
+/**
+ * Sets a surface resolves to, after every per-surface fallback (exact match
+ * -> SurfaceType_Default -> global). Returned by value from
+ * UPRFootstepData::GetResolvedSurface; the pointers reference data owned by
+ * the asset and must not be kept past a change to its properties.
+ */
+struct FPRResolvedSurface {
+  /** Matching config (exact or SurfaceType_Default fallback), or null. */
+  const FPRSurfaceFoleyConfig *Config = nullptr;
+
+  const FPRSurfaceSoundSet *Footstep = nullptr;
+  const FPRSurfaceSoundSet *JumpLaunch = nullptr;
+  const FPRSurfaceSoundSet *LandImpact = nullptr;
+  const FPRSurfaceVFXSet *VFX = nullptr;
+  const FPRSurfaceDecalSet *Decal = nullptr;
+
+  /** Keys used for the per-surface shuffle history. */
+  EPhysicalSurface FootstepKey = SurfaceType_Default;
+  EPhysicalSurface JumpKey = SurfaceType_Default;
+  EPhysicalSurface LandKey = SurfaceType_Default;
+
+  /** SurfaceAudio ranges pre-multiplied by the config multipliers. */
+  FVector2D VolumeRange = FVector2D(1.0f, 1.0f);
+  FVector2D PitchRange = FVector2D(1.0f, 1.0f);
+};
 
 /**
  * Footstep Data Asset — configures surface detection traces, per-surface
@@ -33,6 +70,26 @@ public:
   UPRFootstepData();
 
   virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+  virtual void PostLoad() override;
+
+#if WITH_EDITOR
+  virtual void
+  PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+#endif
+
+  /**
+   * Resolves a surface through the baked config table: a single array index
+   * into Surfaces. Entries that no longer match Surfaces (runtime or
+   * Blueprint edits, assets built at runtime) fall back to a linear search.
+   */
+  FPRResolvedSurface GetResolvedSurface(EPhysicalSurface Surface) const;
+
+  /** Rebakes the dense surface table from the current properties. */
+  void BuildSurfaceLookup();
+
+  /** Soft assets (sounds, VFX, decal material) the surface resolves to. */
+  void GetSurfaceAssetPaths(EPhysicalSurface Surface,
+                            TArray<FSoftObjectPath> &OutPaths) const;
 
   // ==================================================================
   // Trigger Mode
@@ -95,6 +152,23 @@ public:
             meta = (EditCondition = "!bUseFootSockets", EditConditionHides))
   float CapsuleZOffset = 0.0f;
 
+  /**
+   * Routes step/jump/land traces through UPRFoleyTraceSubsystem instead of
+   * tracing synchronously. Results arrive the next frame, batched under the
+   * project-wide budget (Project Settings > Plugins > PR Foley).
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|Trace")
+  bool bUseAsyncTraces = false;
+
+  /**
+   * Takes land, jump and non-socket footstep surfaces from the owning
+   * character's movement (landed hit, CurrentFloor) instead of tracing, and
+   * turns on bReturnMaterialOnMove on its capsule. Foot-socket footsteps
+   * still trace.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|Trace")
+  bool bUseMovementFloor = false;
+
   // ==================================================================
   // Surfaces
   // ==================================================================
@@ -143,6 +217,25 @@ public:
             meta = (ClampMin = "1", ClampMax = "128"))
   int32 MaxActiveDecals = 32;
 
+  /**
+   * InstancedMesh: DecalMaterial must be a surface material applied to
+   * FootprintMesh. It receives PerInstanceCustomData 0 = atlas frame,
+   * 1 = spawn time (world seconds), 2 = lifespan, for the flipbook and fade.
+   * MaxActiveDecals does not apply; see MaxFootprintInstancesPerMaterial.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|Decals")
+  EPRFootprintBackend FootprintBackend = EPRFootprintBackend::Decal;
+
+  /**
+   * Flat quad lying in XY, 100x100 units (e.g. /Engine/BasicShapes/Plane).
+   * Scaled to DecalSize. Without a mesh the Decal backend is used.
+   */
+  UPROPERTY(
+      EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|Decals",
+      meta = (EditCondition =
+                  "FootprintBackend == EPRFootprintBackend::InstancedMesh"))
+  TObjectPtr<UStaticMesh> FootprintMesh;
+
   // ==================================================================
   // Jump
   // ==================================================================
@@ -157,6 +250,15 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|Surfaces")
   bool bEnableLandscapeBlending = true;
 
+  /**
+   * Reads the primary surface and blend weights from the landscape
+   * weightmaps, decoded once per component, instead of tracing. Components
+   * without CPU-readable weightmaps fall back to the hit's PhysMat and the
+   * multi-trace cluster.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|Surfaces")
+  bool bUseLandscapeWeightmaps = true;
+
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|Surfaces",
             meta = (EditCondition = "bEnableLandscapeBlending",
                     EditConditionHides))
@@ -203,11 +305,127 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|Audio")
   FPRFoleyAudioSettings SurfaceAudio;
 
+  /**
+   * Optional persistent MetaSound voice. When set, each character keeps one
+   * instance playing and footstep / jump / land events send their chosen
+   * wave, volume, pitch, surface and event type as parameters, then fire
+   * StepTriggerParamName. Non-wave sounds (cues) fall back to one-shots.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Audio|MetaSound Voice")
+  TObjectPtr<USoundBase> FootstepMetaSound;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Audio|MetaSound Voice")
+  FName StepTriggerParamName = FName("OnStep");
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Audio|MetaSound Voice")
+  FName StepWaveParamName = FName("Wave");
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Audio|MetaSound Voice")
+  FName StepVolumeParamName = FName("Volume");
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Audio|MetaSound Voice")
+  FName StepPitchParamName = FName("Pitch");
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Audio|MetaSound Voice")
+  FName StepSurfaceParamName = FName("Surface");
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Audio|MetaSound Voice")
+  FName StepEventTypeParamName = FName("EventType");
+
+  /**
+   * Sub-frame offset (seconds) of a Distance Mode step. Delay the OnStep
+   * trigger by it in the graph to keep cadence exact at low frame rates.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Audio|MetaSound Voice")
+  FName StepDelayParamName = FName("Delay");
+
+  // ==================================================================
+  // AI Noise
+  // ==================================================================
+
+  /**
+   * Server reports each footstep, jump and land as AI noise (hearing
+   * sense), scaled by the surface's VolumeMultiplier. Reuses the surface
+   * already detected for the event: no extra trace.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|AI Noise")
+  bool bReportAINoise = false;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|AI Noise",
+            meta = (ClampMin = "0.0", EditCondition = "bReportAINoise"))
+  float NoiseLoudness = 1.0f;
+
+  /** Multiplies NoiseLoudness for lands (heavy lands count twice). */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|AI Noise",
+            meta = (ClampMin = "0.0", EditCondition = "bReportAINoise"))
+  float LandNoiseMultiplier = 1.5f;
+
+  /** Hearing range of the noise (0 = each listener's hearing range). */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Footstep|AI Noise",
+            meta = (ClampMin = "0.0", Units = "cm",
+                    EditCondition = "bReportAINoise"))
+  float NoiseMaxRange = 0.0f;
+
   // ==================================================================
   // Optimization
   // ==================================================================
 
+  /**
+   * Audio range: beyond this distance from every local listener the
+   * component is Culled. 0 disables distance culling.
+   */
   UPROPERTY(EditAnywhere, BlueprintReadWrite,
             Category = "PR Footstep|Optimization", meta = (ClampMin = "0.0"))
   float MaxLODDistance = 3000.0f;
+
+  /** Voice / breathing range (0 = same as MaxLODDistance). */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Optimization", meta = (ClampMin = "0.0"))
+  float BreathingMaxDistance = 1500.0f;
+
+  /** Niagara range (0 = same as MaxLODDistance). */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Optimization", meta = (ClampMin = "0.0"))
+  float VFXMaxDistance = 2000.0f;
+
+  /** Footprint range (0 = same as MaxLODDistance). */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Optimization", meta = (ClampMin = "0.0"))
+  float DecalMaxDistance = 1500.0f;
+
+  /**
+   * Visual layers (VFX, decals) need the owner to cover at least this
+   * fraction of a listener's screen. Off-screen owners never qualify.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "PR Footstep|Optimization",
+            meta = (ClampMin = "0.0", ClampMax = "1.0"))
+  float MinVisualScreenSize = 0.02f;
+
+private:
+  /** First Surfaces entry for exactly this surface, or INDEX_NONE. */
+  int32 FindSurfaceConfig(EPhysicalSurface Surface) const;
+
+  /** True if the baked index still points at the entry it was baked for. */
+  bool IsBakedConfigValid(int32 ConfigIndex, EPhysicalSurface Surface) const;
+
+  /**
+   * Dense table indexed by EPhysicalSurface: index into Surfaces of the
+   * config the surface uses (exact or SurfaceType_Default fallback), or
+   * INDEX_NONE for the global sets. Indices, not pointers, so reallocating
+   * Surfaces never leaves it dangling. Not serialized.
+   */
+  TStaticArray<int32, SurfaceType_Max> SurfaceConfigIndices{InPlace,
+                                                            INDEX_NONE};
+
+  /** Surfaces.Num() when the table was baked; -1 = never baked. */
+  int32 BakedSurfaceCount = -1;
 };
@@ -0,0 +1,652 @@
+#pragma once
+
+#include "Chaos/ChaosEngineInterface.h"
+#include "CollisionQueryParams.h"
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+#include "Data/PRFoleyTypes.h"
+#include "Data/PRFootstepData.h"
+#include "Data/PRVoiceData.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/NetSerialization.h"
+#include "Subsystems/PRFoleyDecalPoolSubsystem.h"
+#include "TimerManager.h"
+
+#include "PRFoleyComponent.generated.h"
+
+class ACharacter;
+class UAudioComponent;
+class UNiagaraSystem;
+class USkeletalMeshComponent;
+class USoundBase;
+class USoundWave;
+class UPRFoleyDistanceSubsystem;
+class UPRFoleySignificanceSubsystem;
+class UPRFoleyTraceSubsystem;
+struct FPRLandscapeSurfaceSample;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(
+    FPROnFootstepPlayed, TEnumAsByte<EPhysicalSurface>, Surface, FVector,
+    Location, float, Volume, USoundBase *, Sound);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FPROnVoicePlayed,
+                                               EPRVelocityTier, Tier, float,
+                                               Volume, USoundBase *, Sound);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPROnBreathingTierChanged,
+                                            EPRVelocityTier, NewTier);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
+    FPROnVFXSpawned, TEnumAsByte<EPhysicalSurface>, Surface, FVector, Location,
+    UNiagaraSystem *, System);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FPROnDecalSpawned,
+                                             TEnumAsByte<EPhysicalSurface>,
+                                             Surface, FVector, Location);
+
+/**
+ * Body Foley component — orchestrates 5 independent layers (Footstep, Voice,
+ * VFX, Decal, Network) from two Data Assets.
+ *
+ * Add to a Character, assign FootstepData / VoiceData, and trigger steps from
+ * AnimNotify_PRFootstep or let Distance mode drive them automatically.
+ *
+ * @see UPRFootstepData, UPRVoiceData
+ */
+UCLASS(ClassGroup = (ProtoReady),
+       meta = (BlueprintSpawnableComponent, DisplayName = "PR Foley"))
+class PR_FOLEY_API UPRFoleyComponent : public UActorComponent {
+  GENERATED_BODY()
+
+  friend class UPRFoleyDistanceSubsystem;
+  friend class UPRFoleyNetRelayComponent;
+  friend class UPRFoleyNetRelaySubsystem;
+  friend class UPRFoleySignificanceSubsystem;
+  friend class UPRFoleyTraceSubsystem;
+
+public:
+  UPRFoleyComponent();
+
+  virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+  virtual void
+  TickComponent(float DeltaTime, ELevelTick TickType,
+                FActorComponentTickFunction *ThisTickFunction) override;
+  virtual void GetLifetimeReplicatedProps(
+      TArray<FLifetimeProperty> &OutLifetimeProps) const override;
+  virtual void
+  PreReplication(IRepChangedPropertyTracker &ChangedPropertyTracker) override;
+
+#if WITH_EDITOR
+  virtual void OnComponentCreated() override;
+#endif
+
+  // ==================================================================
+  // Data
+  // ==================================================================
+
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PR Foley|Data")
+  TObjectPtr<UPRFootstepData> FootstepData;
+
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PR Foley|Data")
+  TObjectPtr<UPRVoiceData> VoiceData;
+
+  // ==================================================================
+  // Layers
+  // ==================================================================
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Foley|Layers")
+  bool bEnableFootstepLayer = true;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Foley|Layers")
+  bool bEnableVoiceLayer = true;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Foley|Layers")
+  bool bEnableVFXLayer = false;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Foley|Layers")
+  bool bEnableDecalLayer = false;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Foley|Layers")
+  bool bEnableNetworkReplication = false;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Foley|Layers",
+            meta = (EditCondition = "bEnableNetworkReplication"))
+  EPRFoleyNetMode NetworkMode = EPRFoleyNetMode::ServerRelayed;
+
+  /**
+   * Gameplay weight when breathers compete for real voices
+   * (MaxRealBreathingVoices). The locally controlled character always wins.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Foley|Layers",
+            meta = (ClampMin = "0.0", EditCondition = "bEnableVoiceLayer"))
+  float BreathingPriority = 1.0f;
+
+  // ==================================================================
+  // Debug
+  // ==================================================================
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PR Foley|Debug")
+  bool bDebugTraces = false;
+
+  // ==================================================================
+  // Events
+  // ==================================================================
+
+  UPROPERTY(BlueprintAssignable, Category = "PR Foley|Events")
+  FPROnFootstepPlayed OnFootstepPlayed;
+
+  UPROPERTY(BlueprintAssignable, Category = "PR Foley|Events")
+  FPROnVoicePlayed OnVoicePlayed;
+
+  UPROPERTY(BlueprintAssignable, Category = "PR Foley|Events")
+  FPROnBreathingTierChanged OnBreathingTierChanged;
+
+  UPROPERTY(BlueprintAssignable, Category = "PR Foley|Events")
+  FPROnVFXSpawned OnVFXSpawned;
+
+  UPROPERTY(BlueprintAssignable, Category = "PR Foley|Events")
+  FPROnDecalSpawned OnDecalSpawned;
+
+  // ==================================================================
+  // Core API
+  // ==================================================================
+
+  /** Traces from the given foot socket and plays the footstep layers. */
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void TriggerFootstep(FName SocketName);
+
+  /** Traces below the owner and plays the land layers. */
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void Landing();
+
+  /** Plays the jump effort and the jump surface layers. */
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void HandleJump();
+
+  UFUNCTION(Exec)
+  void TestFootstep();
+
+  UFUNCTION(Exec)
+  void TestJump();
+
+  UFUNCTION(Exec)
+  void TestLand();
+
+  UFUNCTION()
+  void OnLanded(const FHitResult &Hit);
+
+  UFUNCTION()
+  void OnMovementModeChanged(ACharacter *Character, EMovementMode PrevMode,
+                             uint8 PrevCustomMode);
+
+  // ==================================================================
+  // Setters / Getters
+  // ==================================================================
+
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void SetFootIntervalDistance(float NewInterval);
+
+  UFUNCTION(BlueprintPure, Category = "PR Foley")
+  float GetFootIntervalDistance() const;
+
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void SetFootstepData(UPRFootstepData *NewData);
+
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void SetVoiceData(UPRVoiceData *NewData);
+
+  /** Custom speed for breathing. Pass -1 to use the owner velocity. */
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void SetSpeedOverride(float Speed);
+
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void SetSpeedThresholds(float Walk, float Jog, float Sprint);
+
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void SetBreathingDrive(float NormalizedIntensity);
+
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void SetBreathingIntensityOverride(float Intensity);
+
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  void ClearBreathingIntensityOverride();
+
+  UFUNCTION(BlueprintPure, Category = "PR Foley")
+  EPRVelocityTier GetCurrentVelocityTier() const;
+
+  UFUNCTION(BlueprintPure, Category = "PR Foley")
+  EPRVelocityTier GetCurrentBreathingTier() const;
+
+  UFUNCTION(BlueprintPure, Category = "PR Foley")
+  EPhysicalSurface GetLastDetectedSurface() const;
+
+  UFUNCTION(BlueprintPure, Category = "PR Foley")
+  FString GetSurfaceDisplayName(EPhysicalSurface Surface) const;
+
+  UFUNCTION(BlueprintPure, Category = "PR Foley")
+  float GetBreathingIntensity() const;
+
+  /** Tier assigned this frame by UPRFoleySignificanceSubsystem. */
+  UFUNCTION(BlueprintPure, Category = "PR Foley")
+  EPRFoleySignificance GetSignificance() const;
+
+protected:
+  // ==================================================================
+  // Event handling
+  // ==================================================================
+
+  void HandleFootstep(const FHitResult &Hit);
+  void HandleLand(const FHitResult &Hit, float FallSpeed);
+
+  /** Surface part of a jump (audio, VFX, network) once the ground is known. */
+  void HandleJumpSurface(const FHitResult &Hit);
+
+  // ==================================================================
+  // Distance Mode
+  // ==================================================================
+
+  /** Registers with / leaves UPRFoleyDistanceSubsystem per FootstepData. */
+  void UpdateDistanceRegistration();
+
+  /**
+   * Called by UPRFoleyDistanceSubsystem for each stride boundary crossed.
+   * FootIndex indexes FootstepData->FootSockets, or INDEX_NONE. Offset moves
+   * the trace back to where the boundary was crossed this frame; StartDelay
+   * is the matching sub-frame time, sent to the footstep MetaSound voice.
+   */
+  void TriggerDistanceFootstep(int32 FootIndex, const FVector &Offset,
+                               float StartDelay);
+
+  // ==================================================================
+  // Trace
+  // ==================================================================
+
+  /** Computes the trace segment for a step (socket / capsule / root). */
+  bool ComputeFootstepTrace(FName SocketName, FVector &OutStart,
+                            FVector &OutEnd) const;
+  /**
+   * Answers a ground trace from the map's baked surface grid when the cell
+   * is static ground (UPRFoleySurfaceGridSubsystem). No scene query.
+   */
+  bool TraceSurfaceGrid(const FVector &Start, const FVector &End,
+                        FHitResult &OutHit);
+
+  /** True if the trace for SocketName starts from a mesh socket. */
+  bool UsesSocketTrace(FName SocketName) const;
+
+  /**
+   * Ground under the character from UCharacterMovementComponent's
+   * CurrentFloor (bUseMovementFloor). bJustLeftGround also accepts the last
+   * floor seen, within one stride, for jumps.
+   */
+  bool GetMovementFloorHit(FHitResult &OutHit, bool bJustLeftGround = false);
+
+  /** Movement floor (non-socket traces) or surface grid; no scene query. */
+  bool FindGroundWithoutTrace(FName SocketName, const FVector &Start,
+                              const FVector &End, FHitResult &OutHit,
+                              bool bJustLeftGround = false);
+
+  /** Asks the owner's capsule to return PhysMats on its movement sweeps. */
+  void RequestMovementMaterials();
+
+  bool TraceFootstep(FName SocketName, FHitResult &OutHit, FVector &OutStart,
+                     FVector &OutEnd, bool bJustLeftGround = false);
+  bool PerformTrace(const FVector &Start, const FVector &End,
+                    FHitResult &OutHit);
+
+  /** True when FootstepData routes traces through UPRFoleyTraceSubsystem. */
+  bool ShouldUseAsyncTrace() const;
+
+  /** Queues a ground query shaped like PerformTrace on the trace subsystem. */
+  bool RequestAsyncTrace(const FVector &Start, const FVector &End,
+                         EPRFoleyEventType EventType, float FallSpeed = 0.0f);
+
+  /** Called by UPRFoleyTraceSubsystem the frame after the request. */
+  void OnAsyncTraceCompleted(EPRFoleyEventType EventType, bool bHit,
+                             const FHitResult &Hit, float FallSpeed,
+                             float StartDelay);
+
+  void DrawTraceDebug(const FVector &Start, const FVector &End, bool bHit,
+                      const FHitResult &Hit) const;
+
+  EPhysicalSurface GetSurfaceFromHit(const FHitResult &Hit);
+
+  /**
+   * Requests the surface's streamed assets. Returns Surface if resident,
+   * SurfaceType_Default while it is still loading.
+   */
+  EPhysicalSurface StreamSurface(EPhysicalSurface Surface);
+
+  /**
+   * Keeps FootstepData's SurfaceType_Default assets resident, releasing the
+   * pin held on the previous data asset.
+   */
+  void PinDefaultSurface();
+  void UnpinDefaultSurface();
+
+  /** Primes footstep and voice sounds (UPRFoleySettings::bPrewarmSounds). */
+  void PrewarmSounds();
+
+  /** Weightmap surfaces under a landscape hit (UPRFoleyLandscapeSubsystem). */
+  bool SampleLandscapeSurfaces(const FHitResult &Hit,
+                               FPRLandscapeSurfaceSample &OutSample) const;
+
+  bool GetLandscapeBlendSurface(const FHitResult &Hit,
+                                EPhysicalSurface &OutSecondarySurface,
+                                float &OutSecondaryWeight) const;
+
+  /** Query params shared by every trace of this component. */
+  const FCollisionQueryParams &GetFoleyQueryParams() const {
+    return FoleyQueryParams;
+  }
+
+  /** False when the significance pass culled this component. */
+  bool IsInLODRadius() const;
+
+  /** True if the current significance tier allows this layer. */
+  bool IsLayerSignificant(EPRFoleyLayerMask Layer) const;
+
+  /**
+   * Dedicated server: audio, VFX, decal and breathing layers are skipped
+   * (compiled out in server builds), only gameplay-facing detection runs.
+   */
+  bool IsServerStripped() const { return UE_SERVER || bServerStripped; }
+
+  /**
+   * True when the server itself must detect this character's events: it
+   * reports their AI noise or originates their network events (AI,
+   * server-driven pawns, LocalSimulation lands). Stripped components without
+   * one are culled by significance.
+   */
+  bool HasServerConsumer() const;
+
+  /**
+   * Server copy of a remote player in ServerRelayed mode: its events arrive
+   * through Server_FoleyEvents rather than local detection.
+   */
+  bool ReceivesClientEvents() const;
+
+  /** Authority with bReportAINoise: detects even when culled for audio. */
+  bool ReportsAINoise() const;
+
+  /** Detection runs: in range, or the server reports its AI noise. */
+  bool ShouldDetectEvents() const {
+    return IsInLODRadius() || ReportsAINoise();
+  }
+
+  /**
+   * Detected events are played and sent here. False for culled characters
+   * detected only for AI noise, and for remote players whose own client
+   * sends their events.
+   */
+  bool PresentsEvents() const {
+    return IsInLODRadius() && !ReceivesClientEvents();
+  }
+
+  /**
+   * Authority only: queues the event as AI noise (UPRFoleyNoiseSubsystem).
+   * Always from the server's own detection, never from client RPCs, so a
+   * client cannot silence itself or place noise elsewhere.
+   */
+  void ReportFoleyNoise(EPhysicalSurface SurfaceType, const FVector &Location,
+                        EPRFoleyEventType EventType, bool bHeavyLand);
+
+  // ==================================================================
+  // Audio
+  // ==================================================================
+
+  void PlayFootstepSound(EPhysicalSurface SurfaceType, const FVector &Location);
+  void PlaySurfaceFootstep(EPhysicalSurface SurfaceType,
+                           const FVector &SurfaceLocation);
+  void PlaySurfaceJump(EPhysicalSurface SurfaceType,
+                       const FVector &SurfaceLocation);
+  void PlaySurfaceLand(EPhysicalSurface SurfaceType,
+                       const FVector &SurfaceLocation);
+
+  float PlaySoundWithSettings(USoundBase *SoundToPlay, const FVector &Location,
+                              const FPRFoleyAudioSettings &AudioSettings);
+
+  /** Surface sounds: persistent MetaSound voice if set, else one-shot. */
+  float PlaySurfaceSound(USoundBase *SoundToPlay, const FVector &Location,
+                         const FPRFoleyAudioSettings &AudioSettings,
+                         EPhysicalSurface SurfaceType,
+                         EPRFoleyEventType EventType);
+
+  /**
+   * Sends one event to FootstepVoiceComp. False if it cannot play, or if the
+   * voice was already triggered this frame: a second SetParameters batch
+   * would overwrite the first wave before the graph renders it.
+   */
+  bool TriggerFootstepVoice(USoundWave *Wave, float Volume, float Pitch,
+                            EPhysicalSurface SurfaceType,
+                            EPRFoleyEventType EventType);
+
+  /** Stops FootstepVoiceComp; the next voiced event spawns a new one. */
+  void StopFootstepVoice();
+
+  USoundBase *SelectSoundFromSet(const FPRSurfaceSoundSet &SoundSet,
+                                 int32 &LastIndex) const;
+
+  // ==================================================================
+  // Voice / Breathing
+  // ==================================================================
+
+  EPRVelocityTier GetVelocityTier() const;
+  USoundBase *ResolveBreathingLoopSound(EPRVelocityTier Tier) const;
+  void UpdateBreathingLoop(float DeltaTime = 0.0f);
+  void UpdateBreathingMetaSound(float DeltaTime);
+
+  /**
+   * Called by UPRFoleySignificanceSubsystem after each evaluation: sets the
+   * breathing tick rate from the closest listener's distance, or puts
+   * breathing to sleep (sources faded out, tick off) while inaudible.
+   */
+  void UpdateBreathingSchedule(float ListenerDistanceSq);
+
+  void SuspendBreathing();
+  void ResumeBreathing();
+
+  /**
+   * Classic path: starts every BreathingLoops tier silent and paused, so a
+   * tier change only crossfades gains. Loops with virtualization disabled
+   * are switched to PlayWhenSilent. Releases the previous set.
+   */
+  void PrimeBreathingLoops();
+
+  /**
+   * Destroys paused tier loops. Loops still audible or fading finish over
+   * FadeTime and destroy themselves, so a fade already started is not cut.
+   */
+  void ReleaseBreathingLoops(float FadeTime = 0.5f);
+
+  /** Fades the MetaSound voice out and the audible tier loop to silence. */
+  void FadeOutBreathing(float FadeTime);
+
+  /** Pauses tier loops once their fade to silence is over. */
+  void SchedulePauseSilentBreathingLoops(float FadeTime);
+  void PauseSilentBreathingLoops();
+
+  /** BreathingMaxDistance, falling back to MaxLODDistance; 0 = unbounded. */
+  float GetBreathingRange() const;
+
+  /** Awake breathers ranked by this get the real voices; others simulate. */
+  bool IsBreathingAwake() const { return bHasBreathing && !bBreathingAsleep; }
+  float GetBreathingRelevance() const;
+  bool IsBreathingVirtual() const { return bBreathingVirtual; }
+
+  /**
+   * Virtual breathing keeps its tier, intensity and recovery simulated but
+   * plays nothing. Switching fades the sources over BreathingFadeTime, so a
+   * demoted and a promoted breather crossfade.
+   */
+  void SetBreathingVirtual(bool bVirtual);
+
+  // ==================================================================
+  // VFX / Decals
+  // ==================================================================
+
+  const FPRSurfaceVFXSet *ResolveVFXSet(EPhysicalSurface SurfaceType) const;
+  float ComputeVFXScale(const FPRSurfaceVFXSet *VFXSet,
+                        EPRFoleyEventType EventType) const;
+  void SpawnVFX(UNiagaraSystem *System, const FVector &Location,
+                const FVector &Normal, float Scale,
+                EPhysicalSurface SurfaceType);
+  void PlaySurfaceVFX(EPhysicalSurface SurfaceType, const FVector &Location,
+                      const FVector &Normal, EPRFoleyEventType EventType);
+
+  const FPRSurfaceDecalSet *ResolveDecalSet(EPhysicalSurface SurfaceType) const;
+  void SpawnFootprintDecal(EPhysicalSurface SurfaceType,
+                           const FVector &Location, const FVector &Normal);
+
+  /** EPRFootprintBackend::InstancedMesh path of SpawnFootprintDecal. */
+  void SpawnFootprintInstance(EPhysicalSurface SurfaceType,
+                              const FPRSurfaceDecalSet &DecalSet,
+                              const FVector &Location, const FVector &Normal,
+                              const FVector &ForwardDir, int32 Frame);
+
+  // ==================================================================
+  // Network
+  // ==================================================================
+
+  void BroadcastNetworkFoleyEvent(EPhysicalSurface SurfaceType,
+                                  const FVector &Location,
+                                  const FVector &Normal,
+                                  EPRFoleyEventType EventType,
+                                  bool bHeavyLand);
+
+  /**
+   * Buffers an event until the next net update: PreReplication on the
+   * server, a timer at the owner's NetUpdateFrequency on clients. Nothing
+   * is queued in standalone games.
+   */
+  void QueueNetEvent(const FPRFoleyNetEvent &Event);
+
+  /**
+   * Sends the buffered events as one batch RPC, minus those older than the
+   * slowest net update (left over while the actor was dormant or not
+   * relevant).
+   */
+  void FlushNetEvents();
+
+  UFUNCTION(Server, Unreliable)
+  void Server_FoleyEvents(const FPRFoleyNetEventBatch &Batch);
+
+  UFUNCTION(NetMulticast, Unreliable)
+  void Multicast_FoleyEvents(const FPRFoleyNetEventBatch &Batch);
+
+  /**
+   * Plays a received batch on proxies that did not detect it themselves,
+   * each event delayed by its TimeOffset.
+   */
+  void ReceiveFoleyEvents(const FPRFoleyNetEventBatch &Batch);
+
+  /**
+   * Server-side reach of this character's events: the largest of its audio,
+   * VFX, decal and breathing ranges, capped by MaxLODDistance. 0 = unbounded.
+   */
+  float GetNetEventRange() const;
+
+  /** Replication on, in EPRFoleyNetMode::LocalSimulation. */
+  bool UsesLocalSimulation() const;
+
+  void PlayRemoteFoleyEvent(EPhysicalSurface SurfaceType,
+                            const FVector &Location, const FVector &Normal,
+                            EPRFoleyEventType EventType,
+                            EPRVelocityTier VelocityTier, bool bHeavyLand);
+  void PlayRemoteFoleyEvent(const FPRFoleyNetEvent &Event);
+
+private:
+  UPROPERTY()
+  TObjectPtr<USkeletalMeshComponent> OwnerMesh;
+
+  void CacheOwnerMesh();
+
+#if WITH_EDITOR
+  void AutoAssignFootstepData();
+  void AutoAssignVoiceData();
+#endif
+
+  /** Built once in BeginPlay; ignores the owner, returns PhysMats. */
+  FCollisionQueryParams FoleyQueryParams;
+
+  // --- Significance (written by UPRFoleySignificanceSubsystem) ---
+  EPRFoleySignificance Significance = EPRFoleySignificance::Full;
+  EPRFoleyLayerMask SignificantLayers = EPRFoleyLayerMask::All;
+
+  /** Set in BeginPlay on dedicated servers (UPRFoleySettings). */
+  bool bServerStripped = false;
+
+  // --- Distance Mode (stride state lives in UPRFoleyDistanceSubsystem) ---
+  float InstanceDistanceInterval = 0.0f;
+
+  /** Sub-frame placement of the step being triggered (Distance Mode). */
+  FVector StepLocationOffset = FVector::ZeroVector;
+  float StepStartDelay = 0.0f;
+
+  // --- Surface state ---
+  EPhysicalSurface LastDetectedSurface = SurfaceType_Default;
+  FVector LastHitNormal = FVector::UpVector;
+  // --- Network (batched per net update) ---
+  /** Ring of at most MaxEvents; once full, NextNetEvent is the oldest. */
+  TArray<FPRFoleyNetEvent> PendingNetEvents;
+  int32 NextNetEvent = 0;
+  FTimerHandle NetFlushTimerHandle;
+
+  /** Last movement floor used; CurrentFloor is already cleared on jumps. */
+  FHitResult LastFloorHit;
+
+  TMap<EPhysicalSurface, int32> LastSurfaceFootstepIndices;
+  TMap<EPhysicalSurface, int32> LastSurfaceJumpIndices;
+  TMap<EPhysicalSurface, int32> LastSurfaceLandIndices;
+
+  FTimerHandle LandFootstepTimerHandle;
+
+  // --- Footstep MetaSound voice (FootstepData->FootstepMetaSound) ---
+  UPROPERTY(Transient)
+  TObjectPtr<UAudioComponent> FootstepVoiceComp;
+
+  /** GFrameCounter of the last event sent to FootstepVoiceComp. */
+  uint64 FootstepVoiceFrame = MAX_uint64;
+
+  /** Data asset whose SurfaceType_Default this component pinned. */
+  UPROPERTY(Transient)
+  TObjectPtr<const UPRFootstepData> PinnedFootstepData;
+
+  // --- Breathing ---
+  UPROPERTY(Transient)
+  TObjectPtr<UAudioComponent> BreathingComp_A;
+
+  /** Classic loops: one per EPRVelocityTier, primed and paused when silent. */
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UAudioComponent>> BreathingLoopComps;
+
+  /** Tier loop currently faded in, INDEX_NONE when silent. */
+  int32 AudibleBreathingLoop = INDEX_NONE;
+  FTimerHandle BreathingPauseTimerHandle;
+  EPRVelocityTier CurrentBreathingTier = EPRVelocityTier::Idle;
+  EPRVelocityTier PreviousVelocityTier = EPRVelocityTier::Idle;
+  float SpeedOverride = -1.0f;
+  float BreathingIntensityOverride = -1.0f;
+  float BreathingIntensity = 0.0f;
+  // Last values sent to the breathing MetaSound (-1 = resend)
+  float CachedBreathingIntensity = -1.0f;
+  float CachedBreathRate = -1.0f;
+  float CachedEffortLevel = -1.0f;
+  float CachedRecoveryPhase = -1.0f;
+  float RecoveryTimeRemaining = 0.0f;
+  float RecoveryPhaseValue = 0.0f;
+
+  /** Breathing was found in BeginPlay: ticks on UpdateBreathingSchedule. */
+  bool bHasBreathing = false;
+  bool bBreathingAsleep = false;
+  double BreathingSleepTime = 0.0;
+  bool bBreathingVirtual = false;
+  float BreathingListenerDistanceSq = 0.0f;
+
+  // --- Decals ---
+  /** Footprints owned in UPRFoleyDecalPoolSubsystem (ring, MaxActiveDecals). */
+  TArray<FPRFoleyDecalHandle> OwnedDecals;
+  int32 NextOwnedDecal = 0;
+  bool bIsRightFootprint = false;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+#include "Data/PRFoleyTypes.h"
+
+#include "PRFoleyNetRelayComponent.generated.h"
+
+class UPRFoleyComponent;
+
+/**
+ * Per-connection foley channel. Added by UPRFoleyNetRelaySubsystem to each
+ * remote PlayerController the first time an event is routed to it, so a
+ * batch only reaches the clients whose view target is within the event's
+ * range instead of every client the source actor is relevant to.
+ */
+UCLASS(ClassGroup = (ProtoReady), NotBlueprintable)
+class PR_FOLEY_API UPRFoleyNetRelayComponent : public UActorComponent {
+  GENERATED_BODY()
+
+  friend class UPRFoleyNetRelaySubsystem;
+
+public:
+  UPRFoleyNetRelayComponent();
+
+protected:
+  UFUNCTION(Client, Unreliable)
+  void Client_FoleyEvents(UPRFoleyComponent *Source,
+                          const FPRFoleyNetEventBatch &Batch);
+};
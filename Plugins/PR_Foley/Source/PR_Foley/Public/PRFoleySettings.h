@@ -0,0 +1,208 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+
+#include "PRFoleySettings.generated.h"
+
+/**
+ * Project-wide PR Foley settings (Project Settings > Plugins > PR Foley).
+ * Holds the world-level budgets shared by every UPRFoleyComponent.
+ */
+UCLASS(Config = Game, defaultconfig, meta = (DisplayName = "PR Foley"))
+class PR_FOLEY_API UPRFoleySettings : public UDeveloperSettings {
+  GENERATED_BODY()
+
+public:
+  UPRFoleySettings();
+
+  // ==================================================================
+  // Traces
+  // ==================================================================
+
+  /**
+   * Max async ground traces submitted per frame by UPRFoleyTraceSubsystem.
+   * Requests over budget wait for the next frame, oldest first.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Traces",
+            meta = (ClampMin = "1", ClampMax = "4096"))
+  int32 MaxAsyncTracesPerFrame = 64;
+
+  /**
+   * Frames a trace may wait for budget before it is dropped (oldest first),
+   * so a crowd over budget loses steps instead of playing them late.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Traces",
+            meta = (ClampMin = "1", ClampMax = "30"))
+  int32 MaxTraceQueueFrames = 2;
+
+  /**
+   * Distance mode: an owner moving further than this in one frame was
+   * teleported. No steps are emitted along the jump and the stride starts
+   * over. Independent of stride length; 0 disables the check.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Traces",
+            meta = (ClampMin = "0.0", Units = "cm"))
+  float TeleportDistance = 500.0f;
+
+  // ==================================================================
+  // Surface Grid
+  // ==================================================================
+
+  /**
+   * Answers footstep traces over static ground from the map's baked surface
+   * grid (<Map>.pfgrid, see PRFoleyBakeSurfaceGrid) when one exists.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Surface Grid")
+  bool bUseSurfaceGrid = true;
+
+  /** Default cell size used by the PRFoleyBakeSurfaceGrid commandlet. */
+  UPROPERTY(Config, EditAnywhere, Category = "Surface Grid",
+            meta = (ClampMin = "10.0", ClampMax = "500.0", Units = "cm"))
+  float SurfaceGridCellSize = 50.0f;
+
+  // ==================================================================
+  // Audio
+  // ==================================================================
+
+  /**
+   * Audio components kept by UPRFoleyAudioPoolSubsystem for sounds that use
+   * an EffectsChain or ConcurrencySettings. Past this, sounds spawn a
+   * temporary component as before.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Audio",
+            meta = (ClampMin = "0", ClampMax = "1024"))
+  int32 MaxPooledAudioComponents = 64;
+
+  /**
+   * Breathing update rate for characters within BreathingNearRangeFraction
+   * of their breathing range from a listener. Inaudible characters sleep.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Audio",
+            meta = (ClampMin = "1.0", ClampMax = "120.0", Units = "Hz"))
+  float BreathingNearUpdateRate = 30.0f;
+
+  /** Breathing update rate past the near range. */
+  UPROPERTY(Config, EditAnywhere, Category = "Audio",
+            meta = (ClampMin = "1.0", ClampMax = "120.0", Units = "Hz"))
+  float BreathingFarUpdateRate = 5.0f;
+
+  UPROPERTY(Config, EditAnywhere, Category = "Audio",
+            meta = (ClampMin = "0.0", ClampMax = "1.0"))
+  float BreathingNearRangeFraction = 0.5f;
+
+  /**
+   * Breathers allowed to play at once, ranked by distance, loudness and
+   * BreathingPriority. The others are simulated silently. 0 = unlimited.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Audio",
+            meta = (ClampMin = "0", ClampMax = "256"))
+  int32 MaxRealBreathingVoices = 12;
+
+  /**
+   * Breathing MetaSound inputs are resent only when their target moves by
+   * more than this (0-1 range). Endpoints are always sent.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Audio",
+            meta = (ClampMin = "0.0", ClampMax = "0.5"))
+  float BreathingParamThreshold = 0.05f;
+
+  /**
+   * Float input of the breathing MetaSound receiving the time until the
+   * next update, sent with every batch: interpolate the targets over it on
+   * the audio thread. None = the graph receives steps.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Audio")
+  FName BreathingRampParamName = FName("RampTime");
+
+  // ==================================================================
+  // Streaming
+  // ==================================================================
+
+  /**
+   * Memory budget for streamed surface assets (UPRFoleyStreamingSubsystem).
+   * Least recently used surfaces are released first; 0 = unlimited.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Streaming",
+            meta = (ClampMin = "0", Units = "Megabytes"))
+  int32 SurfaceAssetBudgetMB = 128;
+
+  /**
+   * Components stream every surface of their FootstepData and prime the
+   * sounds of their footstep and voice data at BeginPlay, so the first step
+   * on a surface plays on time (see PRFoley.DumpPrimed).
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Streaming")
+  bool bPrewarmSounds = false;
+
+  /**
+   * Memory held by prewarm: prewarmed surfaces (exempt from
+   * SurfaceAssetBudgetMB) and primed voice sounds. Past it, surfaces stream
+   * and sounds load on first use as usual. 0 = unlimited.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Streaming",
+            meta = (ClampMin = "0", Units = "Megabytes",
+                    EditCondition = "bPrewarmSounds"))
+  int32 PrewarmBudgetMB = 32;
+
+  // ==================================================================
+  // Decals
+  // ==================================================================
+
+  /**
+   * Footprint decals shared by the whole world (UPRFoleyDecalPoolSubsystem).
+   * When full, the oldest footprint is recycled.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Decals",
+            meta = (ClampMin = "1", ClampMax = "4096"))
+  int32 MaxPooledDecals = 512;
+
+  /**
+   * Instances per (mesh, material) for the InstancedMesh footprint backend.
+   * When full, the oldest footprint instance is reused.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Decals",
+            meta = (ClampMin = "1", ClampMax = "65536"))
+  int32 MaxFootprintInstancesPerMaterial = 4096;
+
+  // ==================================================================
+  // AI Noise
+  // ==================================================================
+
+  /**
+   * Noise reports closer than this share a cell and are merged into one
+   * stimulus per frame (UPRFoleyNoiseSubsystem).
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "AI Noise",
+            meta = (ClampMin = "10.0", Units = "cm"))
+  float NoiseCellSize = 400.0f;
+
+  /** Tag passed to MakeNoise, e.g. to filter foley in hearing configs. */
+  UPROPERTY(Config, EditAnywhere, Category = "AI Noise")
+  FName NoiseTag = FName("Footstep");
+
+  // ==================================================================
+  // Network
+  // ==================================================================
+
+  /**
+   * Server sends each batch of foley events only to the connections whose
+   * view target is within the character's range (see
+   * UPRFoleyNetRelaySubsystem) instead of multicasting it to every client.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Network")
+  bool bRouteNetEventsByRange = true;
+
+  /** Added to the range to cover movement between two net updates. */
+  UPROPERTY(Config, EditAnywhere, Category = "Network",
+            meta = (ClampMin = "0.0", Units = "cm",
+                    EditCondition = "bRouteNetEventsByRange"))
+  float NetEventRangeMargin = 500.0f;
+
+  /**
+   * Dedicated servers skip the audio, VFX, decal and breathing layers and
+   * only detect the events they replicate. Always on in server builds.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Network")
+  bool bStripDedicatedServer = true;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+/**
+ * PR Foley instrumentation.
+ *
+ * - `stat PRFoley`: cycle counters for the foley pipeline and subsystems.
+ * - CSV category "PRFoley" (`csvprofile start`): per-frame traces issued,
+ *   traces dropped, surface grid hits, sounds spawned, VFX spawned, decals
+ *   alive and RPCs sent.
+ * - Unreal Insights: the same scopes appear as CPU trace events.
+ */
+DECLARE_STATS_GROUP(TEXT("PR Foley"), STATGROUP_PRFoley, STATCAT_Advanced);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(PR_FOLEY_API, PRFoley);
+
+/**
+ * Running totals of the accumulated CSV stats, readable without a CSV
+ * capture (benchmarks, debug tools). Game thread only.
+ */
+struct PR_FOLEY_API FPRFoleyCounters {
+  uint64 TracesIssued = 0;
+  uint64 TracesDropped = 0;
+  uint64 GridHits = 0;
+  uint64 SoundsSpawned = 0;
+  uint64 VFXSpawned = 0;
+  uint64 RPCsSent = 0;
+
+  static FPRFoleyCounters &Get();
+};
+
+/** Adds Value to the PRFoley CSV stat and the matching running total. */
+#define PRFOLEY_COUNT(Name, Value)                                             \
+  do {                                                                         \
+    CSV_CUSTOM_STAT(PRFoley, Name, Value, ECsvCustomStatOp::Accumulate);       \
+    FPRFoleyCounters::Get().Name += (Value);                                   \
+  } while (0)
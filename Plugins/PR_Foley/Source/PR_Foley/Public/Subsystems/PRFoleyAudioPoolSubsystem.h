@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/PRFoleyTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "PRFoleyAudioPoolSubsystem.generated.h"
+
+class UAudioComponent;
+class USoundBase;
+
+/**
+ * World-shared pool of audio components for the one-shot foley path that
+ * needs a component (FPRFoleyAudioSettings with an EffectsChain or
+ * ConcurrencySettings).
+ *
+ * Components are created lazily up to
+ * UPRFoleySettings::MaxPooledAudioComponents and return to the free list when
+ * OnAudioFinished fires. Their source effect chain stays applied between uses,
+ * and a free component already carrying the requested chain is preferred.
+ * When every component is busy, playback falls back to
+ * UGameplayStatics::SpawnSoundAtLocation. Exists in every world so editor
+ * previews (Test* functions) take the same path.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleyAudioPoolSubsystem : public UWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+
+  /** Plays a one-shot at Location with the given settings. */
+  void PlaySound(USoundBase *Sound, const FVector &Location, float Volume,
+                 float Pitch, const FPRFoleyAudioSettings &AudioSettings);
+
+  int32 GetNumPooled() const { return Components.Num(); }
+
+  int32 GetNumFree() const { return FreeComponents.Num(); }
+
+private:
+  UAudioComponent *
+  AcquireComponent(const USoundEffectSourcePresetChain *EffectsChain);
+  void OnComponentFinished(UAudioComponent *Component);
+
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UAudioComponent>> Components;
+
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UAudioComponent>> FreeComponents;
+};
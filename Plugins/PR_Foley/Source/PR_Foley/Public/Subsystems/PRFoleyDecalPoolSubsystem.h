@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "PRFoleyDecalPoolSubsystem.generated.h"
+
+class UDecalComponent;
+class UMaterialInstanceDynamic;
+class UMaterialInterface;
+
+/**
+ * Identifies one use of a pooled decal slot. The serial changes every time
+ * the slot is recycled, so a stale handle never releases someone else's
+ * footprint.
+ */
+struct FPRFoleyDecalHandle {
+  int32 Slot = INDEX_NONE;
+  uint32 Serial = 0;
+
+  bool IsValid() const { return Slot != INDEX_NONE; }
+};
+
+/** Footprint placement passed to UPRFoleyDecalPoolSubsystem::SpawnDecal. */
+struct FPRFoleyDecalSpawnParams {
+  UMaterialInterface *Material = nullptr;
+
+  /** Flipbook frame, or INDEX_NONE to use Material as is. */
+  int32 Frame = INDEX_NONE;
+  FName FrameParamName;
+
+  FVector Extent = FVector::ZeroVector;
+  FVector Location = FVector::ZeroVector;
+  FRotator Rotation = FRotator::ZeroRotator;
+  float LifeSpan = 0.0f;
+  float FadeScreenSize = 0.001f;
+};
+
+/**
+ * World-shared, fixed-capacity pool of footprint decals.
+ *
+ * Decal components are created once (up to UPRFoleySettings::MaxPooledDecals)
+ * and recycled through a ring buffer: when the pool is full the oldest slot is
+ * reused. Flipbook frames share one MID per (material, frame) instead of one
+ * per decal, and expiry is handled by a single pass over the slots in Tick.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleyDecalPoolSubsystem
+    : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual bool IsTickable() const override { return NumActive > 0; }
+
+  /** Places a footprint, evicting the oldest one if the pool is full. */
+  FPRFoleyDecalHandle SpawnDecal(const FPRFoleyDecalSpawnParams &Params);
+
+  /** Hides the footprint if the handle still owns its slot. */
+  void ReleaseDecal(const FPRFoleyDecalHandle &Handle);
+
+  int32 GetNumActiveDecals() const { return NumActive; }
+
+  int32 GetNumCachedMaterials() const { return FrameMIDs.Num(); }
+
+protected:
+  virtual bool
+  DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+  UDecalComponent *CreateDecal() const;
+  UDecalComponent *AcquireSlot(int32 &OutSlot);
+  void DeactivateSlot(int32 Slot);
+  UMaterialInterface *GetFrameMaterial(UMaterialInterface *Material,
+                                       FName ParamName, int32 Frame);
+
+  // --- Slots (same index = same decal) ---
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UDecalComponent>> Decals;
+
+  /** World time at which the slot is hidden, 0 when free. */
+  TArray<double> ExpireTimes;
+  TArray<uint32> Serials;
+
+  /** Next slot to hand out (oldest in ring order). */
+  int32 NextSlot = 0;
+  int32 NumActive = 0;
+
+  // --- MID cache ---
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UMaterialInstanceDynamic>> FrameMIDs;
+
+  TMap<TTuple<TObjectKey<UMaterialInterface>, FName, int32>, int32>
+      FrameMIDIndices;
+};
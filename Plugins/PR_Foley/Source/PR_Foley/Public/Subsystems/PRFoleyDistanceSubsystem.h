@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "PRFoleyDistanceSubsystem.generated.h"
+
+class UPRFoleyComponent;
+
+/**
+ * Drives EPRFootstepTriggerMode::Distance for every foley component in the
+ * world from a single tick.
+ *
+ * Stride state lives in parallel arrays (structure-of-arrays). Each frame
+ * owner locations are gathered on the game thread, distances are accumulated
+ * in one ParallelFor pass, and only the components that crossed a stride
+ * boundary are dispatched back to the game thread to trigger their step.
+ *
+ * Every stride crossed during the frame is emitted, placed where the owner
+ * crossed it along the frame's path and delayed by the matching fraction of
+ * the frame, so cadence holds at low or variable tick rates.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleyDistanceSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+
+  /**
+   * Adds the component, or refreshes its interval / socket count if already
+   * registered. Accumulated distance is preserved.
+   */
+  void RegisterComponent(UPRFoleyComponent *Component);
+
+  void UnregisterComponent(UPRFoleyComponent *Component);
+
+  bool IsRegistered(const UPRFoleyComponent *Component) const {
+    return IndexByComponent.Contains(Component);
+  }
+
+  int32 GetNumRegistered() const { return Components.Num(); }
+
+protected:
+  virtual bool
+  DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+  void RemoveAtSwap(int32 Index);
+
+  // --- Structure of arrays (same index = same component) ---
+  // Keyed by object index and serial, so an entry whose component was
+  // destroyed without unregistering never matches a new component that
+  // reuses its address.
+  TArray<TObjectKey<UPRFoleyComponent>> Components;
+  TArray<FVector> LastLocations;
+  TArray<FVector> CurrentLocations;
+  TArray<double> AccumulatedDistances;
+  TArray<float> StrideIntervals;
+  TArray<int32> FootIndices;
+  TArray<int32> NumFootSockets;
+
+  /** Per-frame: 1 if the entry is simulated this frame. */
+  TArray<uint8> ActiveFlags;
+
+  /** Per-frame: stride boundaries crossed (0 = no step). */
+  TArray<uint8> StepCounts;
+
+  /** Per-frame: path length to the first crossing, and total. */
+  TArray<float> FirstStepDistances;
+  TArray<float> FrameDistances;
+
+  /** Per-frame: owner displacement (Current - Last). */
+  TArray<FVector> FrameDeltas;
+
+  TMap<TObjectKey<UPRFoleyComponent>, int32> IndexByComponent;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "PRFoleyFootprintSubsystem.generated.h"
+
+class AActor;
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UStaticMesh;
+
+/** One world-level ISM and the ring state of its instances. */
+USTRUCT()
+struct FPRFootprintBatch {
+  GENERATED_BODY()
+
+  UPROPERTY(Transient)
+  TObjectPtr<UInstancedStaticMeshComponent> Component;
+
+  /** World time at which the instance is hidden, 0 when free. */
+  TArray<double> ExpireTimes;
+
+  /** Next instance to reuse once the batch is full (oldest in ring order). */
+  int32 NextInstance = 0;
+  int32 NumActive = 0;
+};
+
+/**
+ * Instanced backend for footprints (EPRFootprintBackend::InstancedMesh).
+ *
+ * Every (mesh, material) pair maps to one instanced static mesh owned by a
+ * transient host actor; each footprint is an instance carrying its atlas
+ * frame, spawn time and lifespan as per-instance custom data. Instances are
+ * reused in ring order up to UPRFoleySettings::MaxFootprintInstancesPerMaterial
+ * and expired ones are collapsed to zero scale in a single pass per tick.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleyFootprintSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  /** Custom data floats per instance: frame, spawn time, lifespan. */
+  static constexpr int32 NumCustomDataFloats = 3;
+
+  virtual void Deinitialize() override;
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual bool IsTickable() const override { return NumActive > 0; }
+
+  /**
+   * Places one footprint instance. Transform is in world space and already
+   * scaled to the footprint size. Returns false if no instance was placed.
+   */
+  bool AddFootprint(UStaticMesh *Mesh, UMaterialInterface *Material,
+                    const FTransform &Transform, int32 Frame, float LifeSpan);
+
+  int32 GetNumActiveFootprints() const { return NumActive; }
+
+  int32 GetNumBatches() const { return Batches.Num(); }
+
+protected:
+  virtual bool
+  DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+  FPRFootprintBatch *FindOrAddBatch(UStaticMesh *Mesh,
+                                    UMaterialInterface *Material);
+
+  UPROPERTY(Transient)
+  TObjectPtr<AActor> HostActor;
+
+  UPROPERTY(Transient)
+  TArray<FPRFootprintBatch> Batches;
+
+  TMap<TPair<TObjectKey<UStaticMesh>, TObjectKey<UMaterialInterface>>, int32>
+      BatchIndices;
+
+  int32 NumActive = 0;
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Chaos/ChaosEngineInterface.h"
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "PRFoleyLandscapeSubsystem.generated.h"
+
+class ULandscapeComponent;
+class ULevel;
+class UTexture2D;
+
+/** Two strongest landscape surfaces at a point, weights normalized to 1. */
+struct FPRLandscapeSurfaceSample {
+  EPhysicalSurface PrimarySurface = SurfaceType_Default;
+  float PrimaryWeight = 0.0f;
+  EPhysicalSurface SecondarySurface = SurfaceType_Default;
+  float SecondaryWeight = 0.0f;
+};
+
+/**
+ * CPU-side surface weights decoded from landscape weightmaps.
+ *
+ * Each ULandscapeComponent's layer allocations are decoded once into a
+ * per-vertex weight array keyed by each layer's physical material (layers
+ * without one use the proxy's DefaultPhysMaterial). Game worlds decode every
+ * component of a level when it is added to the world; other worlds decode on
+ * first use. A footstep then costs a bilinear sample, with no scene query.
+ *
+ * Weightmaps are read from the texture source in editor builds and from the
+ * resident mip otherwise. Cooked builds usually drop that mip's CPU copy, so
+ * PRFoleyBakeSurfaceGrid also bakes every component's weights next to the
+ * map as <Map>.pfland; components neither decoded nor baked return no
+ * sample (counted in GetNumFailedComponents) and the caller falls back to
+ * traces.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleyLandscapeSubsystem : public UWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+  virtual void Deinitialize() override;
+  virtual void OnWorldBeginPlay(UWorld &InWorld) override;
+
+  /**
+   * Samples the surface weights under a landscape hit. Returns false if the
+   * hit is not on a landscape or its weightmaps could not be decoded.
+   */
+  bool SampleSurfaces(const FHitResult &Hit, FPRLandscapeSurfaceSample &Out);
+
+  int32 GetNumDecodedComponents() const { return Components.Num(); }
+
+  int64 GetDecodedBytes() const { return DecodedBytes; }
+
+  /** Components with neither readable weightmaps nor baked weights. */
+  int32 GetNumFailedComponents() const { return NumFailedComponents; }
+
+  /** Content/<path>/<Map>.pfland for a map's long package name. */
+  static FString GetBakedWeightsFilename(const FString &MapPackageName);
+
+#if WITH_EDITOR
+  /**
+   * Decodes every landscape component of World and saves their weights to
+   * Filename. Returns the number of components written, 0 if the world has
+   * no landscape (nothing is written), INDEX_NONE on a write failure.
+   */
+  int32 SaveBakedWeights(UWorld &World, const FString &Filename);
+#endif
+
+private:
+  /** Weights[Vertex * Surfaces.Num() + Layer], vertices row-major. */
+  struct FComponentWeights {
+    TObjectKey<ULevel> Level;
+    TArray<EPhysicalSurface> Surfaces;
+    TArray<uint8> Weights;
+    int32 SizeVerts = 0;
+  };
+
+  /** Mip 0 of a weightmap texture, shared by the components using it. */
+  struct FWeightmapTexels {
+    TArray<FColor> Texels;
+    int32 SizeX = 0;
+    int32 SizeY = 0;
+  };
+
+  using FTexelCache = TMap<const UTexture2D *, FWeightmapTexels>;
+
+  /** Landscape GUID and section base: both survive cooking. */
+  using FBakedKey = TPair<FGuid, FIntPoint>;
+
+  static constexpr uint32 BakedFileMagic = 0x574C4650; // "PFLW"
+  static constexpr uint32 BakedFileVersion = 1;
+
+  const FComponentWeights *FindOrDecode(const ULandscapeComponent *Component,
+                                        FTexelCache &TexelCache);
+  static bool DecodeComponent(const ULandscapeComponent &Component,
+                              FTexelCache &TexelCache,
+                              FComponentWeights &Out);
+  static const FWeightmapTexels *ReadWeightmap(const UTexture2D *Texture,
+                                               FTexelCache &TexelCache);
+
+  static FBakedKey MakeBakedKey(const ULandscapeComponent &Component);
+  static void SerializeWeights(FArchive &Ar, FComponentWeights &Weights);
+  bool LoadBakedWeights(const FString &Filename);
+
+  void DecodeLevel(ULevel *Level);
+  void OnLevelAdded(ULevel *Level, UWorld *InWorld);
+  void OnLevelRemoved(ULevel *Level, UWorld *InWorld);
+
+  TMap<TObjectKey<ULandscapeComponent>, FComponentWeights> Components;
+  int64 DecodedBytes = 0;
+  int32 NumFailedComponents = 0;
+
+  /** Loaded from <Map>.pfland; used where live decoding fails. */
+  TMap<FBakedKey, FComponentWeights> BakedWeights;
+
+  FDelegateHandle LevelAddedHandle;
+  FDelegateHandle LevelRemovedHandle;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/PRFoleyTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "PRFoleyNetRelaySubsystem.generated.h"
+
+class APlayerController;
+class UNetConnection;
+class UPRFoleyComponent;
+class UPRFoleyNetRelayComponent;
+
+/**
+ * Server side of range-based net event routing (see
+ * UPRFoleySettings::bRouteNetEventsByRange). Keeps one
+ * UPRFoleyNetRelayComponent per remote PlayerController and, on the first
+ * batch of each frame, snapshots every view target location; each batch is
+ * then filtered against that array instead of walking the controllers.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleyNetRelaySubsystem : public UWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+
+  /**
+   * Sends each remote connection the events of Batch within Range of its
+   * view target, skipping the connection owning Source (it played them
+   * already). Local views (listen server, split-screen) share one delivery
+   * of the events within Range of any of them.
+   */
+  void RouteEvents(UPRFoleyComponent &Source,
+                   const FPRFoleyNetEventBatch &Batch, float Range);
+
+protected:
+  virtual bool
+  DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+  struct FRemoteView {
+    FVector Location = FVector::ZeroVector;
+    TWeakObjectPtr<UNetConnection> Connection;
+    TWeakObjectPtr<UPRFoleyNetRelayComponent> Relay;
+  };
+
+  /** Rebuilds the view arrays once per frame. */
+  void UpdateViews();
+
+  UPRFoleyNetRelayComponent *FindOrAddRelay(APlayerController &PC);
+
+  TArray<FRemoteView> RemoteViews;
+  TArray<FVector> LocalViews;
+  uint64 ViewsFrame = MAX_uint64;
+
+  /** Relay of each remote controller, added on its first routed batch. */
+  TMap<TObjectKey<APlayerController>,
+       TWeakObjectPtr<UPRFoleyNetRelayComponent>>
+      Relays;
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "PRFoleyNoiseSubsystem.generated.h"
+
+/**
+ * Collects the AI noise reported by foley events and emits it once per
+ * frame. Reports are hashed by instigator and cell of
+ * UPRFoleySettings::NoiseCellSize; every pair becomes a single
+ * AActor::MakeNoise (UAISense_Hearing when the AI module is loaded) at the
+ * loudness-weighted centre of its reports, with the loudest report's
+ * loudness. Different instigators are never merged, so team and affiliation
+ * filters still see who made each noise.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleyNoiseSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+
+  /** Queues a noise for this frame's flush. MaxRange 0 = listener's range. */
+  void ReportNoise(AActor *Instigator, const FVector &Location, float Loudness,
+                   float MaxRange);
+
+protected:
+  virtual bool
+  DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+  using FNoiseKey = TPair<TObjectKey<AActor>, FIntVector>;
+
+  struct FPendingNoise {
+    TWeakObjectPtr<AActor> Instigator;
+    FVector WeightedLocation = FVector::ZeroVector;
+    float TotalWeight = 0.0f;
+    float Loudness = 0.0f;
+    float MaxRange = 0.0f;
+  };
+
+  /** (Instigator, cell) -> merged noise; emptied every flush. */
+  TMap<FNoiseKey, FPendingNoise> PendingNoises;
+};
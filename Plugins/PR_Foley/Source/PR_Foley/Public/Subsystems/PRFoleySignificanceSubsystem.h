@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "PRFoleySignificanceSubsystem.generated.h"
+
+class UPRFoleyComponent;
+
+/**
+ * Assigns every foley component an EPRFoleySignificance tier once per frame.
+ *
+ * Listeners are the cameras of every local player controller (split-screen
+ * included). A component keeps a layer if any listener is within that layer's
+ * range (UPRFootstepData Optimization category); visual layers additionally
+ * require a minimum on-screen size. Call sites then read the cached tier
+ * instead of querying the camera themselves.
+ *
+ * Without any local listener (dedicated server, no player yet) every
+ * component stays Full.
+ *
+ * Then hands out the breathing voice budget (MaxRealBreathingVoices): the
+ * most relevant awake breathers play, the rest are virtual.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleySignificanceSubsystem
+    : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+
+  void RegisterComponent(UPRFoleyComponent *Component);
+  void UnregisterComponent(UPRFoleyComponent *Component);
+
+  int32 GetNumListeners() const { return Listeners.Num(); }
+
+protected:
+  virtual bool
+  DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+  struct FListener {
+    FVector Location = FVector::ZeroVector;
+    FVector Forward = FVector::ForwardVector;
+    /** cos(half FOV), widened a little so edge characters keep visuals. */
+    float CosHalfFOV = 0.0f;
+    /** 0.5 / tan(half FOV): converts radius / distance into screen size. */
+    float ScreenMultiple = 1.0f;
+  };
+
+  void GatherListeners();
+  void EvaluateComponent(UPRFoleyComponent &Component) const;
+  void AssignBreathingVoices();
+
+  TArray<FListener> Listeners;
+  TArray<TWeakObjectPtr<UPRFoleyComponent>> Components;
+
+  /** Scratch for AssignBreathingVoices, kept between frames. */
+  TArray<TPair<float, UPRFoleyComponent *>> Breathers;
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Chaos/ChaosEngineInterface.h"
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "PRFoleyStreamingSubsystem.generated.h"
+
+class UPRFootstepData;
+class USoundBase;
+struct FStreamableHandle;
+
+/** Resident memory of one streamed surface (see GetResidentSurfaces). */
+USTRUCT(BlueprintType)
+struct FPRFoleySurfaceMemory {
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = "PR Foley")
+  TObjectPtr<const UPRFootstepData> FootstepData;
+
+  UPROPERTY(BlueprintReadOnly, Category = "PR Foley")
+  TEnumAsByte<EPhysicalSurface> Surface = SurfaceType_Default;
+
+  UPROPERTY(BlueprintReadOnly, Category = "PR Foley")
+  int64 ResidentBytes = 0;
+
+  UPROPERTY(BlueprintReadOnly, Category = "PR Foley")
+  bool bLoading = false;
+
+  UPROPERTY(BlueprintReadOnly, Category = "PR Foley")
+  bool bPinned = false;
+};
+
+/**
+ * Streams the soft-referenced sounds, Niagara systems and decal materials of
+ * each footstep surface on demand.
+ *
+ * A surface is requested when a foley component detects it; the first events
+ * on a surface that is still loading play SurfaceType_Default instead. Loaded
+ * surfaces are kept under UPRFoleySettings::SurfaceAssetBudgetMB and the
+ * least recently used ones are released first. SurfaceType_Default of every
+ * data asset in use is pinned until its last component lets it go. Outside
+ * game worlds (editor previews) loads are synchronous.
+ *
+ * With UPRFoleySettings::bPrewarmSounds, components also prewarm their data
+ * at BeginPlay: every surface is streamed in and each sound primed (first
+ * chunk fetched and retained), so the first step on a surface does not wait
+ * for a load, a chunk fetch or a decoder start. Prewarmed surfaces count
+ * against PrewarmBudgetMB instead of the LRU budget and are never evicted;
+ * those over it fall back to regular LRU surfaces.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleyStreamingSubsystem : public UWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+
+  /**
+   * Marks the surface as used this frame and starts loading it if needed.
+   * Returns true once its assets are resident. bPin adds one pin, held
+   * until the matching UnpinSurface.
+   */
+  bool RequestSurface(const UPRFootstepData *Data, EPhysicalSurface Surface,
+                      bool bPin = false);
+
+  /** Drops one pin; the last one makes the surface an LRU candidate again. */
+  void UnpinSurface(const UPRFootstepData *Data, EPhysicalSurface Surface);
+
+  bool IsSurfaceResident(const UPRFootstepData *Data,
+                         EPhysicalSurface Surface) const;
+
+  /** Per-surface resident memory, for debugging and budgeting tools. */
+  UFUNCTION(BlueprintCallable, Category = "PR Foley")
+  TArray<FPRFoleySurfaceMemory> GetResidentSurfaces() const;
+
+  /** LRU-managed surfaces only; prewarmed ones are in GetPrimedBytes(). */
+  UFUNCTION(BlueprintPure, Category = "PR Foley")
+  int64 GetTotalResidentBytes() const { return TotalResidentBytes; }
+
+  /** Logs GetResidentSurfaces() (console: PRFoley.DumpSurfaceMemory). */
+  void DumpSurfaceMemory() const;
+
+  /** Streams every surface of Data and primes its sounds once loaded. */
+  void PrewarmFootstepData(const UPRFootstepData *Data);
+
+  /** Primes already loaded sounds (voice data, MetaSound voices). */
+  void PrewarmSounds(TConstArrayView<USoundBase *> Sounds);
+
+  /** Prewarmed surfaces plus primed voice sounds (PrewarmBudgetMB). */
+  UFUNCTION(BlueprintPure, Category = "PR Foley")
+  int64 GetPrimedBytes() const { return PrimedBytes; }
+
+  /** Logs primed sounds and what the budget skipped (PRFoley.DumpPrimed). */
+  void DumpPrimedSounds() const;
+
+private:
+  enum class EPrewarm : uint8 {
+    None,
+    /** Requested by PrewarmFootstepData, held once loaded if it fits. */
+    Pending,
+    /** Counted in PrimedBytes, never evicted by EnforceBudget. */
+    Held,
+    /** Did not fit PrewarmBudgetMB: a regular LRU surface. */
+    OverBudget
+  };
+
+  struct FEntry {
+    TWeakObjectPtr<const UPRFootstepData> Data;
+    EPhysicalSurface Surface = SurfaceType_Default;
+    TSharedPtr<FStreamableHandle> Handle;
+    int64 ResidentBytes = 0;
+    uint64 LastUsedFrame = 0;
+    bool bResident = false;
+    /** One per component pinning the surface (see RequestSurface). */
+    int32 PinCount = 0;
+    EPrewarm Prewarm = EPrewarm::None;
+  };
+
+  using FEntryKey = TPair<TObjectKey<UPRFootstepData>, uint8>;
+
+  struct FPrimedSound {
+    TWeakObjectPtr<USoundBase> Sound;
+    int64 Bytes = 0;
+    /** Compressed first chunk held by USoundWave::RetainCompressedAudio. */
+    bool bRetained = false;
+    /** Held surface it was primed for; its bytes are the surface's. */
+    TOptional<FEntryKey> Surface;
+  };
+
+  void OnSurfaceLoaded(FEntryKey Key);
+  void EnforceBudget();
+
+  /** Moves a loaded surface under PrewarmBudgetMB and primes its sounds. */
+  void HoldPrewarmSurface(const FEntryKey &Key, FEntry &Entry);
+
+  /** Releases held surfaces whose data asset was garbage collected. */
+  void PruneHeldSurfaces();
+
+  bool FitsPrewarmBudget(int64 Bytes);
+
+  void PrimeEntrySounds(const FEntryKey &Key, const FEntry &Entry);
+  void PrimeSound(USoundBase *Sound, const FEntryKey *Surface = nullptr);
+
+  /** Drops the sounds primed for a released surface. */
+  void ReleasePrimedSounds(const FEntryKey &Key);
+
+  /** Drops sounds that were garbage collected, returning their bytes. */
+  void PrunePrimedSounds();
+
+  void ReleasePrimedSound(const FPrimedSound &Primed);
+
+  TMap<FEntryKey, FEntry> Entries;
+  int64 TotalResidentBytes = 0;
+
+  TMap<TObjectKey<USoundBase>, FPrimedSound> PrimedSounds;
+  int64 PrimedBytes = 0;
+  int32 NumSkippedOverBudget = 0;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Chaos/ChaosEngineInterface.h"
+#include "CoreMinimal.h"
+#include "Data/PRFoleySurfaceGrid.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "PRFoleySurfaceGridSubsystem.generated.h"
+
+class UPhysicalMaterial;
+
+/**
+ * Loads the baked surface grid of the current map and answers vertical
+ * footstep traces over static ground with an O(1) cell read.
+ *
+ * Hits built from the grid carry no actor or component; their PhysMaterial
+ * is a transient material with the cell's primary SurfaceType. Cells flagged
+ * Dynamic or MultiLevel, cells without walkable ground and traces that do
+ * not reach the cell height are left to the scene query.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleySurfaceGridSubsystem : public UWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual bool DoesSupportWorldType(
+      const EWorldType::Type WorldType) const override;
+  virtual void Deinitialize() override;
+  virtual void OnWorldBeginPlay(UWorld &InWorld) override;
+
+  /** Fills OutHit from the grid if it can answer the Start-End trace. */
+  bool TraceGrid(const FVector &Start, const FVector &End, FHitResult &OutHit);
+
+  /** Baked blend of the static ground cell under Location. */
+  bool GetBlendSurface(const FVector &Location,
+                       EPhysicalSurface &OutSecondarySurface,
+                       float &OutSecondaryWeight) const;
+
+  bool HasGrid() const { return Grid.IsLoaded(); }
+
+  const FPRFoleySurfaceGrid &GetGrid() const { return Grid; }
+
+private:
+  UPhysicalMaterial *GetSurfaceMaterial(EPhysicalSurface Surface);
+
+  FPRFoleySurfaceGrid Grid;
+
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UPhysicalMaterial>> SurfaceMaterials;
+};
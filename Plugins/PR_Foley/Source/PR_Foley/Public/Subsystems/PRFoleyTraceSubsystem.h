@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CollisionShape.h"
+#include "CoreMinimal.h"
+#include "Data/PRFoleyTypes.h"
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+
+#include "PRFoleyTraceSubsystem.generated.h"
+
+class UPRFoleyComponent;
+
+/** One pending ground query issued by a foley component. */
+struct FPRFoleyTraceRequest {
+  TWeakObjectPtr<UPRFoleyComponent> Component;
+  FVector Start = FVector::ZeroVector;
+  FVector End = FVector::ZeroVector;
+  FCollisionShape Shape;
+  ECollisionChannel Channel = ECC_Visibility;
+  EPRFoleyEventType EventType = EPRFoleyEventType::Footstep;
+
+  /** Fall speed captured when the land was detected (Land only). */
+  float FallSpeed = 0.0f;
+
+  /** Sub-frame start delay of a Distance Mode step. */
+  float StartDelay = 0.0f;
+
+  /** Multi trace: retry as a line trace if the sweep misses. */
+  bool bLineFallback = false;
+
+  /** GFrameCounter when first queued; kept across the line fallback. */
+  uint64 QueuedFrame = 0;
+};
+
+/**
+ * Batches foley ground traces from every UPRFoleyComponent in the world and
+ * submits them through the async scene query API.
+ *
+ * Requests are queued during the frame, submitted from Tick under
+ * UPRFoleySettings::MaxAsyncTracesPerFrame (oldest first), and delivered back
+ * to their component the next frame. Requests still waiting after
+ * MaxTraceQueueFrames are dropped (counted as TracesDropped). Components that
+ * were destroyed in the meantime are silently skipped.
+ */
+UCLASS()
+class PR_FOLEY_API UPRFoleyTraceSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+  virtual void Deinitialize() override;
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+
+  /** Queues a ground query. Returns false if the world cannot trace. */
+  bool RequestTrace(const FPRFoleyTraceRequest &Request);
+
+  /** Requests queued but not yet submitted (over budget). */
+  int32 GetNumPendingTraces() const { return PendingRequests.Num(); }
+
+  /** Requests submitted and waiting for their result. */
+  int32 GetNumInFlightTraces() const { return InFlightRequests.Num(); }
+
+protected:
+  virtual bool
+  DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+  void SubmitRequest(FPRFoleyTraceRequest &&Request);
+  void OnTraceCompleted(const FTraceHandle &Handle, FTraceDatum &Datum);
+
+  /** Requests waiting for budget, ordered by QueuedFrame. */
+  TArray<FPRFoleyTraceRequest> PendingRequests;
+
+  /** Submitted requests keyed by FTraceDatum::UserData. */
+  TMap<uint32, FPRFoleyTraceRequest> InFlightRequests;
+
+  FTraceDelegate TraceDelegate;
+  uint32 NextRequestId = 1;
+};
@@ -0,0 +1,513 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/StaticMeshComponent.h"
+#include "Data/PRFootstepData.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Materials/MaterialInterface.h"
+#include "Math/RandomStream.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "PRFoleyComponent.h"
+#include "PRFoleyStats.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Sound/SoundWave.h"
+#include "Subsystems/PRFoleyDecalPoolSubsystem.h"
+#include "UObject/UObjectArray.h"
+
+/**
+ * Headless crowd benchmark for UPRFoleyComponent.
+ *
+ *   UnrealEditor-Cmd ProtoReadyHost.uproject -nullrhi -nosound -unattended
+ *     -ExecCmds="Automation RunTests ProtoReadyHost.Benchmark.Foley.Crowd;Quit"
+ *
+ * Spawns N characters carrying a foley component in Distance mode on a
+ * floor tiled with several physical surfaces, drives them through
+ * CharacterMovement with scripted input (straight walks and periodic jumps,
+ * so landings are measured too) and ticks the world a fixed number of
+ * frames at 60 Hz. A local PlayerController viewing the floor gives the
+ * significance pass a listener. Results are appended to
+ * Saved/Automation/PRFoleyCrowdBenchmark.csv and compared to
+ * Source/ProtoReadyHost/Tests/PRFoleyCrowdBaseline.csv.
+ *
+ * Options:
+ *   -PRFoleyBenchFrames=600      measured frames (after 60 warm-up frames)
+ *   -PRFoleyBenchAsync           use the async trace path
+ *   -PRFoleyBenchMovementFloor   surfaces from CharacterMovement's floor
+ *   -PRFoleyBenchData=/Game/...  real UPRFootstepData (forced to Distance)
+ *   -PRFoleyBenchTolerance=0.2   allowed regression over the baseline
+ *   -PRFoleyBenchStrict          regressions and missing baseline rows are
+ *                                errors instead of warnings
+ *   -PRFoleyBenchUpdateBaseline  write this run's results as the baseline
+ */
+
+namespace PRFoleyCrowdBenchmark {
+
+constexpr int32 NumSurfaces = 4;
+constexpr int32 TilesPerSide = 8;
+constexpr float TileSize = 2000.0f;
+constexpr float WalkSpeed = 400.0f;
+/** Capsule center at spawn: characters drop onto the floor first. */
+constexpr float SpawnHeight = 150.0f;
+constexpr float MinJumpInterval = 2.0f;
+constexpr float MaxJumpInterval = 5.0f;
+constexpr float FixedDeltaTime = 1.0f / 60.0f;
+constexpr int32 WarmUpFrames = 60;
+
+const TCHAR *BaselineHeader = TEXT("NumCharacters,Async,MovementFloor,"
+                                   "GameThreadMsAvg,UObjectsCreated");
+
+/** Counts every UObject constructed while alive. */
+class FObjectCreateCounter : public FUObjectArray::FUObjectCreateListener {
+public:
+  FObjectCreateCounter() { GUObjectArray.AddUObjectCreateListener(this); }
+
+  virtual ~FObjectCreateCounter() override {
+    if (bRegistered) {
+      GUObjectArray.RemoveUObjectCreateListener(this);
+    }
+  }
+
+  virtual void NotifyUObjectCreated(const UObjectBase *Object,
+                                    int32 Index) override {
+    ++NumCreated;
+  }
+
+  virtual void OnUObjectArrayShutdown() override {
+    GUObjectArray.RemoveUObjectCreateListener(this);
+    bRegistered = false;
+  }
+
+  int64 NumCreated = 0;
+
+private:
+  bool bRegistered = true;
+};
+
+struct FWalker {
+  ACharacter *Character = nullptr;
+  FVector Direction = FVector::ForwardVector;
+  float NextJumpTime = 0.0f;
+};
+
+struct FResult {
+  int32 NumCharacters = 0;
+  int32 NumFrames = 0;
+  bool bAsync = false;
+  bool bMovementFloor = false;
+  double GameThreadMsAvg = 0.0;
+  double GameThreadMsP95 = 0.0;
+  double TracesPerSecond = 0.0;
+  uint64 SoundsSpawned = 0;
+  uint64 VFXSpawned = 0;
+  int32 DecalsAlive = 0;
+  int64 UObjectsCreated = 0;
+};
+
+FString GetBaselinePath() {
+  return FPaths::Combine(FPaths::GameSourceDir(), TEXT("ProtoReadyHost"),
+                         TEXT("Tests"), TEXT("PRFoleyCrowdBaseline.csv"));
+}
+
+FString GetResultsPath() {
+  return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Automation"),
+                         TEXT("PRFoleyCrowdBenchmark.csv"));
+}
+
+/** Floor of TilesPerSide^2 cubes cycling through NumSurfaces surfaces. */
+void SpawnFloor(UWorld *World) {
+  UStaticMesh *Cube =
+      LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+
+  TArray<UPhysicalMaterial *> Materials;
+  for (int32 Index = 0; Index < NumSurfaces; ++Index) {
+    UPhysicalMaterial *Material = NewObject<UPhysicalMaterial>(World);
+    Material->SurfaceType =
+        static_cast<EPhysicalSurface>(SurfaceType1 + Index);
+    Materials.Add(Material);
+  }
+
+  // The cube is 100 units wide, centered: top face at Z = 0
+  const FVector TileScale(TileSize / 100.0f, TileSize / 100.0f, 1.0f);
+  const float Origin = -0.5f * TileSize * (TilesPerSide - 1);
+  for (int32 X = 0; X < TilesPerSide; ++X) {
+    for (int32 Y = 0; Y < TilesPerSide; ++Y) {
+      const FVector Location(Origin + X * TileSize, Origin + Y * TileSize,
+                             -50.0f);
+      AStaticMeshActor *Tile = World->SpawnActor<AStaticMeshActor>(
+          Location, FRotator::ZeroRotator);
+      UStaticMeshComponent *Mesh = Tile->GetStaticMeshComponent();
+      Mesh->SetStaticMesh(Cube);
+      Mesh->SetWorldScale3D(TileScale);
+      Mesh->SetPhysMaterialOverride(Materials[(X + Y) % NumSurfaces]);
+    }
+  }
+}
+
+/** Generated data: one sound set per surface, decals, Distance mode. */
+UPRFootstepData *MakeFootstepData(UWorld *World, bool bAsync,
+                                  bool bMovementFloor) {
+  FString DataPath;
+  if (FParse::Value(FCommandLine::Get(), TEXT("PRFoleyBenchData="),
+                    DataPath)) {
+    if (const UPRFootstepData *Source =
+            LoadObject<UPRFootstepData>(nullptr, *DataPath)) {
+      UPRFootstepData *Data = DuplicateObject(Source, World);
+      Data->TriggerMode = EPRFootstepTriggerMode::Distance;
+      Data->bUseAsyncTraces = bAsync;
+      Data->bUseMovementFloor = bMovementFloor;
+      return Data;
+    }
+  }
+
+  UPRFootstepData *Data = NewObject<UPRFootstepData>(World);
+  Data->TriggerMode = EPRFootstepTriggerMode::Distance;
+  Data->bUseFootSockets = false;
+  Data->TraceStartRef = EPRTraceStartReference::Root;
+  Data->bUseAsyncTraces = bAsync;
+  Data->bUseMovementFloor = bMovementFloor;
+  Data->bEnableLandscapeBlending = false;
+  Data->DefaultDecal.DecalMaterial = TSoftObjectPtr<UMaterialInterface>(
+      FSoftObjectPath(TEXT("/Engine/EngineMaterials/"
+                           "DefaultDeferredDecalMaterial."
+                           "DefaultDeferredDecalMaterial")));
+  Data->DefaultDecal.FrameIndexParamName = NAME_None;
+
+  for (int32 Index = 0; Index <= NumSurfaces; ++Index) {
+    FPRSurfaceFoleyConfig &Config = Data->Surfaces.AddDefaulted_GetRef();
+    Config.Surface = static_cast<EPhysicalSurface>(Index);
+    for (int32 Variation = 0; Variation < 3; ++Variation) {
+      // Silent, but real sound assets for the playback path
+      Config.Footstep.Sounds.Add(NewObject<USoundWave>(World));
+    }
+  }
+  return Data;
+}
+
+TArray<FWalker> SpawnWalkers(UWorld *World, UPRFootstepData *Data,
+                             int32 NumCharacters, FRandomStream &Random) {
+  const float HalfExtent = 0.5f * TileSize * TilesPerSide - TileSize * 0.25f;
+
+  FActorSpawnParameters Params;
+  Params.SpawnCollisionHandlingOverride =
+      ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+  TArray<FWalker> Walkers;
+  Walkers.Reserve(NumCharacters);
+  for (int32 Index = 0; Index < NumCharacters; ++Index) {
+    const FVector Location(Random.FRandRange(-HalfExtent, HalfExtent),
+                           Random.FRandRange(-HalfExtent, HalfExtent),
+                           SpawnHeight);
+    ACharacter *Character = World->SpawnActor<ACharacter>(
+        ACharacter::StaticClass(), FTransform(Location), Params);
+    if (!Character) {
+      continue;
+    }
+
+    // No controller: the scripted input drives CharacterMovement directly
+    UCharacterMovementComponent *Movement = Character->GetCharacterMovement();
+    Movement->bRunPhysicsWithNoController = true;
+    Movement->MaxWalkSpeed = WalkSpeed;
+
+    UPRFoleyComponent *Foley = NewObject<UPRFoleyComponent>(Character);
+    Foley->FootstepData = Data;
+    Foley->bEnableVoiceLayer = false;
+    Foley->bEnableVFXLayer = true;
+    Foley->bEnableDecalLayer = true;
+    Foley->bEnableNetworkReplication = false;
+    Foley->RegisterComponent();
+
+    FWalker &Walker = Walkers.AddDefaulted_GetRef();
+    Walker.Character = Character;
+    Walker.Direction =
+        FVector(Random.GetUnitVector2D(), 0.0f).GetSafeNormal2D();
+    Walker.NextJumpTime = Random.FRandRange(0.0f, MaxJumpInterval);
+  }
+  return Walkers;
+}
+
+/** Listener at the floor center, for the significance pass. */
+void SpawnViewer(UWorld *World) {
+  AActor *Camera = World->SpawnActor<AActor>(AActor::StaticClass(),
+                                             FTransform::Identity);
+  USceneComponent *Root = NewObject<USceneComponent>(Camera, TEXT("Root"));
+  Camera->SetRootComponent(Root);
+  Root->RegisterComponent();
+  Root->SetWorldLocationAndRotation(FVector(0.0f, 0.0f, 1000.0f),
+                                    FRotator(-30.0f, 0.0f, 0.0f));
+
+  APlayerController *Viewer = World->SpawnActor<APlayerController>();
+  Viewer->SetViewTarget(Camera);
+}
+
+/** Straight walks bouncing off the floor edges, with periodic jumps. */
+void MoveWalkers(TArray<FWalker> &Walkers, float Time, FRandomStream &Random) {
+  const float HalfExtent = 0.5f * TileSize * TilesPerSide - TileSize * 0.25f;
+  for (FWalker &Walker : Walkers) {
+    ACharacter *Character = Walker.Character;
+    const FVector Location = Character->GetActorLocation();
+    if (FMath::Abs(Location.X) > HalfExtent &&
+        Location.X * Walker.Direction.X > 0.0f) {
+      Walker.Direction.X = -Walker.Direction.X;
+    }
+    if (FMath::Abs(Location.Y) > HalfExtent &&
+        Location.Y * Walker.Direction.Y > 0.0f) {
+      Walker.Direction.Y = -Walker.Direction.Y;
+    }
+    Character->AddMovementInput(Walker.Direction);
+
+    if (Time >= Walker.NextJumpTime) {
+      Character->Jump();
+      Walker.NextJumpTime =
+          Time + Random.FRandRange(MinJumpInterval, MaxJumpInterval);
+    } else {
+      Character->StopJumping();
+    }
+  }
+}
+
+FResult Run(int32 NumCharacters, int32 NumFrames, bool bAsync,
+            bool bMovementFloor) {
+  FResult Result;
+  Result.NumCharacters = NumCharacters;
+  Result.NumFrames = NumFrames;
+  Result.bAsync = bAsync;
+  Result.bMovementFloor = bMovementFloor;
+
+  UWorld *World = UWorld::CreateWorld(EWorldType::Game, false,
+                                      TEXT("PRFoleyCrowdBenchmark"));
+  FWorldContext &Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+  Context.SetCurrentWorld(World);
+  World->InitializeActorsForPlay(FURL());
+  World->BeginPlay();
+
+  FRandomStream Random(0x5EED);
+  SpawnFloor(World);
+  SpawnViewer(World);
+  UPRFootstepData *Data = MakeFootstepData(World, bAsync, bMovementFloor);
+  TArray<FWalker> Walkers = SpawnWalkers(World, Data, NumCharacters, Random);
+
+  float Time = 0.0f;
+  for (int32 Frame = 0; Frame < WarmUpFrames; ++Frame) {
+    MoveWalkers(Walkers, Time, Random);
+    World->Tick(LEVELTICK_All, FixedDeltaTime);
+    Time += FixedDeltaTime;
+  }
+
+  const FPRFoleyCounters CountersBefore = FPRFoleyCounters::Get();
+  TArray<double> FrameMs;
+  FrameMs.Reserve(NumFrames);
+  {
+    FObjectCreateCounter ObjectCounter;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame) {
+      MoveWalkers(Walkers, Time, Random);
+
+      // Only the world tick is timed (CharacterMovement included), not the
+      // scripted input
+      const double Start = FPlatformTime::Seconds();
+      World->Tick(LEVELTICK_All, FixedDeltaTime);
+      FrameMs.Add((FPlatformTime::Seconds() - Start) * 1000.0);
+      Time += FixedDeltaTime;
+    }
+    Result.UObjectsCreated = ObjectCounter.NumCreated;
+  }
+  const FPRFoleyCounters &CountersAfter = FPRFoleyCounters::Get();
+
+  double TotalMs = 0.0;
+  for (const double Ms : FrameMs) {
+    TotalMs += Ms;
+  }
+  FrameMs.Sort();
+  Result.GameThreadMsAvg = NumFrames > 0 ? TotalMs / NumFrames : 0.0;
+  Result.GameThreadMsP95 =
+      NumFrames > 0 ? FrameMs[FMath::Min(NumFrames - 1, NumFrames * 95 / 100)]
+                    : 0.0;
+  Result.TracesPerSecond =
+      (CountersAfter.TracesIssued - CountersBefore.TracesIssued) /
+      FMath::Max(NumFrames * FixedDeltaTime, UE_SMALL_NUMBER);
+  Result.SoundsSpawned =
+      CountersAfter.SoundsSpawned - CountersBefore.SoundsSpawned;
+  Result.VFXSpawned = CountersAfter.VFXSpawned - CountersBefore.VFXSpawned;
+  if (const UPRFoleyDecalPoolSubsystem *DecalPool =
+          World->GetSubsystem<UPRFoleyDecalPoolSubsystem>()) {
+    Result.DecalsAlive = DecalPool->GetNumActiveDecals();
+  }
+
+  GEngine->DestroyWorldContext(World);
+  World->DestroyWorld(false);
+  CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+  return Result;
+}
+
+void AppendResult(const FResult &Result) {
+  const FString Path = GetResultsPath();
+  FString Line;
+  if (!IFileManager::Get().FileExists(*Path)) {
+    Line = TEXT("Timestamp,NumCharacters,NumFrames,Async,MovementFloor,"
+                "GameThreadMsAvg,GameThreadMsP95,TracesPerSecond,"
+                "SoundsSpawned,VFXSpawned,DecalsAlive,UObjectsCreated\n");
+  }
+  Line += FString::Printf(
+      TEXT("%s,%d,%d,%d,%d,%.4f,%.4f,%.1f,%llu,%llu,%d,%lld\n"),
+      *FDateTime::UtcNow().ToIso8601(), Result.NumCharacters,
+      Result.NumFrames, Result.bAsync ? 1 : 0,
+      Result.bMovementFloor ? 1 : 0, Result.GameThreadMsAvg,
+      Result.GameThreadMsP95, Result.TracesPerSecond, Result.SoundsSpawned,
+      Result.VFXSpawned, Result.DecalsAlive, Result.UObjectsCreated);
+  FFileHelper::SaveStringToFile(Line, *Path,
+                                FFileHelper::EEncodingOptions::AutoDetect,
+                                &IFileManager::Get(), FILEWRITE_Append);
+}
+
+FString GetBaselineKey(const FResult &Result) {
+  return FString::Printf(TEXT("%d,%d,%d"), Result.NumCharacters,
+                         Result.bAsync ? 1 : 0, Result.bMovementFloor ? 1 : 0);
+}
+
+/** Baseline rows keyed by "NumCharacters,Async,MovementFloor". */
+TMap<FString, TArray<FString>> LoadBaseline() {
+  TMap<FString, TArray<FString>> Rows;
+  TArray<FString> Lines;
+  FFileHelper::LoadFileToStringArray(Lines, *GetBaselinePath());
+  for (const FString &Line : Lines) {
+    TArray<FString> Fields;
+    Line.ParseIntoArray(Fields, TEXT(","));
+    if (Fields.Num() >= 5 && Fields[0].IsNumeric()) {
+      Rows.Add(FString::Join(TArrayView<FString>(Fields).Left(3), TEXT(",")),
+               Fields);
+    }
+  }
+  return Rows;
+}
+
+void UpdateBaseline(const FResult &Result) {
+  TMap<FString, TArray<FString>> Rows = LoadBaseline();
+  Rows.Add(GetBaselineKey(Result),
+           {FString::FromInt(Result.NumCharacters),
+            FString::FromInt(Result.bAsync ? 1 : 0),
+            FString::FromInt(Result.bMovementFloor ? 1 : 0),
+            FString::Printf(TEXT("%.4f"), Result.GameThreadMsAvg),
+            FString::Printf(TEXT("%lld"), Result.UObjectsCreated)});
+
+  Rows.KeySort([](const FString &A, const FString &B) {
+    return FCString::Atoi(*A) != FCString::Atoi(*B)
+               ? FCString::Atoi(*A) < FCString::Atoi(*B)
+               : A < B;
+  });
+
+  FString Text = FString(BaselineHeader) + TEXT("\n");
+  for (const TPair<FString, TArray<FString>> &Row : Rows) {
+    Text += FString::Join(Row.Value, TEXT(",")) + TEXT("\n");
+  }
+  FFileHelper::SaveStringToFile(Text, *GetBaselinePath());
+}
+
+} // namespace PRFoleyCrowdBenchmark
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FPRFoleyCrowdBenchmark,
+                                  "ProtoReadyHost.Benchmark.Foley.Crowd",
+                                  EAutomationTestFlags::EditorContext |
+                                      EAutomationTestFlags::PerfFilter)
+
+void FPRFoleyCrowdBenchmark::GetTests(TArray<FString> &OutBeautifiedNames,
+                                      TArray<FString> &OutTestCommands) const {
+  for (const int32 Count : {100, 500, 1000, 2500, 5000}) {
+    OutBeautifiedNames.Add(FString::Printf(TEXT("%d Characters"), Count));
+    OutTestCommands.Add(FString::FromInt(Count));
+  }
+}
+
+bool FPRFoleyCrowdBenchmark::RunTest(const FString &Parameters) {
+  using namespace PRFoleyCrowdBenchmark;
+
+  const int32 NumCharacters = FCString::Atoi(*Parameters);
+  int32 NumFrames = 600;
+  FParse::Value(FCommandLine::Get(), TEXT("PRFoleyBenchFrames="), NumFrames);
+  float Tolerance = 0.2f;
+  FParse::Value(FCommandLine::Get(), TEXT("PRFoleyBenchTolerance="),
+                Tolerance);
+  const bool bAsync =
+      FParse::Param(FCommandLine::Get(), TEXT("PRFoleyBenchAsync"));
+  const bool bMovementFloor =
+      FParse::Param(FCommandLine::Get(), TEXT("PRFoleyBenchMovementFloor"));
+  const bool bStrict =
+      FParse::Param(FCommandLine::Get(), TEXT("PRFoleyBenchStrict"));
+
+  if (!GEngine || NumCharacters <= 0 || NumFrames <= 0) {
+    AddError(TEXT("Invalid benchmark parameters."));
+    return false;
+  }
+
+  const FResult Result =
+      Run(NumCharacters, NumFrames, bAsync, bMovementFloor);
+  AppendResult(Result);
+
+  AddInfo(FString::Printf(
+      TEXT("%d characters, %d frames%s%s: %.3f ms avg, %.3f ms p95, %.0f "
+           "traces/s, %llu sounds, %llu VFX, %d decals alive, %lld UObjects "
+           "created"),
+      Result.NumCharacters, Result.NumFrames,
+      bAsync ? TEXT(" (async)") : TEXT(""),
+      bMovementFloor ? TEXT(" (movement floor)") : TEXT(""),
+      Result.GameThreadMsAvg, Result.GameThreadMsP95, Result.TracesPerSecond,
+      Result.SoundsSpawned, Result.VFXSpawned, Result.DecalsAlive,
+      Result.UObjectsCreated));
+
+  if (FParse::Param(FCommandLine::Get(), TEXT("PRFoleyBenchUpdateBaseline"))) {
+    UpdateBaseline(Result);
+    AddInfo(TEXT("Baseline updated."));
+    return true;
+  }
+
+  const FString Key = GetBaselineKey(Result);
+  const TMap<FString, TArray<FString>> BaselineRows = LoadBaseline();
+  const TArray<FString> *Baseline = BaselineRows.Find(Key);
+  if (!Baseline) {
+    // Strict runs gate CI: a missing row must not pass silently
+    const FString Message = FString::Printf(
+        TEXT("No baseline for %s in %s, run with "
+             "-PRFoleyBenchUpdateBaseline."),
+        *Key, *GetBaselinePath());
+    if (bStrict) {
+      AddError(Message);
+      return false;
+    }
+    AddWarning(Message);
+    return true;
+  }
+
+  auto Check = [&](const TCHAR *Metric, double Value, double BaselineValue) {
+    if (BaselineValue > 0.0 && Value > BaselineValue * (1.0 + Tolerance)) {
+      const FString Message = FString::Printf(
+          TEXT("%s regressed: %.3f vs baseline %.3f (+%.0f%%)"), Metric, Value,
+          BaselineValue, 100.0 * (Value / BaselineValue - 1.0));
+      if (bStrict) {
+        AddError(Message);
+      } else {
+        AddWarning(Message);
+      }
+    }
+  };
+  Check(TEXT("GameThreadMsAvg"), Result.GameThreadMsAvg,
+        FCString::Atod(*(*Baseline)[3]));
+  Check(TEXT("UObjectsCreated"), static_cast<double>(Result.UObjectsCreated),
+        FCString::Atod(*(*Baseline)[4]));
+
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,101 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Data/PRFootstepData.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "PRFoleyComponent.h"
+#include "Subsystems/PRFoleyDistanceSubsystem.h"
+
+/**
+ * UPRFoleyDistanceSubsystem bookkeeping when a registered component is
+ * destroyed without UnregisterComponent (world teardown, GC):
+ *
+ *   UnrealEditor-Cmd ProtoReadyHost.uproject -nullrhi -nosound -unattended
+ *     -ExecCmds="Automation RunTests ProtoReadyHost.Foley.Distance;Quit"
+ *
+ * The stale entry is swapped by an unregister, then purged by Tick; the
+ * remaining components must keep consistent indices afterwards.
+ */
+
+namespace PRFoleyDistanceSubsystemTest {
+
+UPRFoleyComponent *SpawnFoley(UWorld *World, UPRFootstepData *Data) {
+  AActor *Actor = World->SpawnActor<AActor>(AActor::StaticClass(),
+                                            FTransform::Identity);
+  UPRFoleyComponent *Foley = NewObject<UPRFoleyComponent>(Actor);
+  Foley->FootstepData = Data;
+  return Foley;
+}
+
+} // namespace PRFoleyDistanceSubsystemTest
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FPRFoleyDistanceStaleComponentTest,
+    "ProtoReadyHost.Foley.Distance.DestroyedWithoutUnregister",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPRFoleyDistanceStaleComponentTest::RunTest(const FString &Parameters) {
+  using namespace PRFoleyDistanceSubsystemTest;
+
+  if (!GEngine) {
+    AddError(TEXT("No engine."));
+    return false;
+  }
+
+  UWorld *World = UWorld::CreateWorld(EWorldType::Game, false,
+                                      TEXT("PRFoleyDistanceSubsystemTest"));
+  FWorldContext &Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+  Context.SetCurrentWorld(World);
+  World->InitializeActorsForPlay(FURL());
+  World->BeginPlay();
+
+  UPRFoleyDistanceSubsystem *Distance =
+      World->GetSubsystem<UPRFoleyDistanceSubsystem>();
+  UPRFootstepData *Data = NewObject<UPRFootstepData>(World);
+  Data->TriggerMode = EPRFootstepTriggerMode::Distance;
+
+  if (TestNotNull(TEXT("Distance subsystem"), Distance)) {
+    UPRFoleyComponent *First = SpawnFoley(World, Data);
+    UPRFoleyComponent *Second = SpawnFoley(World, Data);
+    UPRFoleyComponent *Doomed = SpawnFoley(World, Data);
+    Distance->RegisterComponent(First);
+    Distance->RegisterComponent(Second);
+    Distance->RegisterComponent(Doomed);
+    TestEqual(TEXT("Registered"), Distance->GetNumRegistered(), 3);
+
+    // Destroyed without unregistering, then freed by GC
+    Doomed->GetOwner()->Destroy();
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+    // The stale last entry is swapped into First's slot
+    Distance->UnregisterComponent(First);
+    TestFalse(TEXT("First unregistered"), Distance->IsRegistered(First));
+    TestTrue(TEXT("Second still registered"), Distance->IsRegistered(Second));
+    TestEqual(TEXT("Before purge"), Distance->GetNumRegistered(), 2);
+
+    // Tick purges the stale entry through its swapped index
+    Distance->Tick(1.0f / 60.0f);
+    TestEqual(TEXT("After purge"), Distance->GetNumRegistered(), 1);
+    TestTrue(TEXT("Second survives purge"), Distance->IsRegistered(Second));
+
+    // A new component (possibly at the freed address) gets its own slot
+    UPRFoleyComponent *Fresh = SpawnFoley(World, Data);
+    Distance->RegisterComponent(Fresh);
+    TestEqual(TEXT("Fresh registered"), Distance->GetNumRegistered(), 2);
+    TestTrue(TEXT("Fresh lookup"), Distance->IsRegistered(Fresh));
+
+    Distance->UnregisterComponent(Second);
+    Distance->UnregisterComponent(Fresh);
+    TestEqual(TEXT("All unregistered"), Distance->GetNumRegistered(), 0);
+    TestFalse(TEXT("Fresh unregistered"), Distance->IsRegistered(Fresh));
+  }
+
+  GEngine->DestroyWorldContext(World);
+  World->DestroyWorld(false);
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS